@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# bench.sh
+#
+# time eonasm over synthetic workloads
+# usage: bench.sh size+
+#   EONASM  binary to time (default ./eonasm)
+#   RUNS    runs per workload, median and spread are reported (default 3)
+#   RESULTS append "name median unit spread" lines for benchcmp
+#
+EONASM=${EONASM:-./eonasm}
+RUNS=${RUNS:-3}
+OUT=bench/out
+mkdir -p $OUT
+
+printf "%-14s %8s %6s %10s %10s %10s %7s\n" workload lines passes "wall ms" "cpu ms" "lines/s" spread
+for size in "$@"; do
+    src=$OUT/gen-$size.asm
+    [ -f $src ] || bench/eongen $size > $src || exit 1
+    rm -f $OUT/gen-$size.runs
+    run=0
+    while [ $run -lt $RUNS ]; do
+	$EONASM --stats $OUT/gen-$size.hex $src 2> $OUT/gen-$size.stats > /dev/null || {
+	    cat $OUT/gen-$size.stats
+	    exit 1
+	}
+	awk '
+	    /stats: pass/  {passes++}
+	    /stats: total/ {wall = $5; cpu = $8; rate = $10}
+	    END {print wall / 1000, cpu / 1000, rate, passes}
+	' $OUT/gen-$size.stats >> $OUT/gen-$size.runs
+	run=$((run + 1))
+    done
+    sort -n $OUT/gen-$size.runs | awk -v name=gen-$size -v lines=$(wc -l < $src) -v results="$RESULTS" '
+	{wall[NR] = $1; cpu[NR] = $2; rate[NR] = $3; passes = $4}
+	END {
+	    m	   = int ((NR + 1) / 2)
+	    spread = wall[m] > 0 ? (wall[NR] - wall[1]) * 100 / wall[m] : 0
+	    printf "%-14s %8d %6d %10.1f %10.1f %10d %6.1f%%\n", name, lines, passes, wall[m], cpu[m], rate[m], spread
+	    if (results != "")
+		printf "%-28s %12.2f ms %6.1f%%\n", "e2e/" name, wall[m], spread >> results
+	}
+    '
+done
@@ -0,0 +1,104 @@
+/*
+ * benchcmp.c
+ *
+ * compare benchmark results against a saved baseline
+ * result lines: name median unit spread%
+ *
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * config
+ */
+#define MAX_RESULTS	    1024    // results per file
+#define MAX_NAME	    64	    // benchmark name chars
+#define THRESHOLD	    5.0     // default significance threshold (%)
+
+/*
+ * results
+ */
+typedef struct {
+    char    name[MAX_NAME];
+    char    unit[16];
+    double  median;
+    double  spread;
+} result_t;
+
+static unsigned load (const char *path, result_t *v) {
+    FILE *f = fopen (path, "r");
+    if (!f) {
+	fprintf (stderr, "benchcmp: can not open [%s]\n", path);
+	exit (2);
+    }
+    unsigned n = 0;
+    char     line[256];
+    while (n < MAX_RESULTS && fgets (line, sizeof (line), f)) {
+	result_t *r = &v[n];
+	if (sscanf (line, "%63s %lf %15s %lf", r->name, &r->median, r->unit, &r->spread) == 4)
+	    n++;
+    }
+    fclose (f);
+    return n;
+}
+
+static result_t * find (result_t *v, unsigned n, const char *name) {
+    for (unsigned i = 0; i < n; i++)
+	if (!strcmp (v[i].name, name))
+	    return &v[i];
+    return NULL;
+}
+
+/*
+ * entry point
+ */
+int main (int argc, char **argv) {
+    if (argc < 3) {
+	fprintf (stderr,
+	    "benchcmp, compare benchmark results against a baseline\n"
+	    "usage  : benchcmp baseline current [threshold%%]\n"
+	    );
+	return 2;
+    }
+    double threshold = argc > 3 ? atof (argv[3]) : THRESHOLD;
+
+    static result_t vbase[MAX_RESULTS];
+    static result_t vcur[MAX_RESULTS];
+    unsigned nbase = load (argv[1], vbase);
+    unsigned ncur  = load (argv[2], vcur);
+
+    // a change is significant when it exceeds both the threshold and the noise of either run
+    unsigned regressions = 0;
+    unsigned improvements = 0;
+    printf ("%-28s %12s %12s %8s %7s\n", "benchmark", "baseline", "current", "speedup", "noise");
+    for (unsigned i = 0; i < ncur; i++) {
+	result_t *c = &vcur[i];
+	result_t *b = find (vbase, nbase, c->name);
+	if (!b) {
+	    printf ("%-28s %12s %12.2f %8s %7s  new\n", c->name, "-", c->median, "-", "-");
+	    continue;
+	}
+	double noise   = b->spread > c->spread ? b->spread : c->spread;
+	double limit   = noise > threshold ? noise : threshold;
+	double speedup = c->median > 0 ? b->median / c->median : 1;
+	double change  = b->median > 0 ? (c->median - b->median) * 100 / b->median : 0;
+	const char *verdict = "";
+	if (change > limit) {
+	    verdict = "  REGRESSION";
+	    regressions++;
+	} else if (-change > limit) {
+	    verdict = "  improved";
+	    improvements++;
+	}
+	printf ("%-28s %12.2f %12.2f %7.2fx %6.1f%%%s\n", c->name, b->median, c->median, speedup, noise, verdict);
+    }
+    for (unsigned i = 0; i < nbase; i++)
+	if (!find (vcur, ncur, vbase[i].name))
+	    printf ("%-28s %12.2f %12s %8s %7s  gone\n", vbase[i].name, vbase[i].median, "-", "-", "-");
+
+    // summary
+    printf ("%u benchmarks, %u improved, %u regressed (threshold %.1f%%)\n", ncur, improvements, regressions, threshold);
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * eongen.c
+ *
+ * synthetic eon workload generator for eonasm benchmarks
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * config
+ */
+#define MAX_EQU 	    256     // equate chain length
+#define MAX_LOCAL	    8	    // local labels per routine
+
+/*
+ * deterministic random numbers (xorshift32)
+ */
+static uint32_t seed = 2022;
+
+static uint32_t rnd (uint32_t n) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed <<  5;
+    return seed % n;
+}
+
+/*
+ * generator state
+ */
+static unsigned lines;	    // lines generated
+static unsigned nequ;	    // equates defined
+static unsigned nroutine;   // routines to generate
+static unsigned ntable;     // data tables generated
+
+static void out (const char *label, const char *body) {
+    printf ("%s\t%s\n", label, body);
+    lines++;
+}
+
+static int reg (void) {
+    return rnd (14);
+}
+
+/*
+ * header: .EQU chains referencing previous equates
+ */
+static void equates (unsigned n) {
+    char body[128];
+    char name[32];
+    for (nequ = 0; nequ < n; nequ++) {
+	snprintf (name, sizeof (name), "K%u", nequ);
+	if (nequ == 0)
+	    snprintf (body, sizeof (body), ".EQU\t%u", rnd (1000));
+	else switch (rnd (4)) {
+	    case 0:  snprintf (body, sizeof (body), ".EQU\tK%u + %u", nequ - 1, rnd (100)); break;
+	    case 1:  snprintf (body, sizeof (body), ".EQU\tK%u * 2 - K%u", rnd (nequ), rnd (nequ)); break;
+	    case 2:  snprintf (body, sizeof (body), ".EQU\t$%X", rnd (0x10000)); break;
+	    default: snprintf (body, sizeof (body), ".EQU\t(K%u + %u) & $FFFF", rnd (nequ), rnd (64)); break;
+	}
+	out (name, body);
+    }
+}
+
+/*
+ * one routine: locals, loops, forward branches, calls and mixed li widths
+ */
+static void routine (unsigned id) {
+    char     body[128];
+    char     label[32];
+    unsigned size   = 8 + rnd (24);
+    unsigned nlocal = 1 + rnd (MAX_LOCAL);
+    unsigned placed = 0;    // locals defined so far
+
+    snprintf (label, sizeof (label), "FN%u", id);
+    out (label, "enter\t.FRAME");
+
+    for (unsigned i = 0; i < size; i++) {
+	// place a local label at a regular spacing
+	label[0] = 0;
+	if (placed < nlocal && i == placed * size / nlocal)
+	    snprintf (label, sizeof (label), ".L%u", placed++);
+
+	switch (rnd (16)) {
+	    case 0:  snprintf (body, sizeof (body), "li\tr%d, %u", reg (), rnd (2)); break;
+	    case 1:  snprintf (body, sizeof (body), "li\tr%d, %d", reg (), (int) rnd (2000) - 1000); break;
+	    case 2:  snprintf (body, sizeof (body), "li\tr%d, $%X", reg (), 0x10000 + rnd (0x7fff0000)); break;
+	    case 3:  snprintf (body, sizeof (body), "li\tr%d, FN%u", reg (), rnd (nroutine)); break;
+	    case 4:  snprintf (body, sizeof (body), "li\tr%d, K%u", reg (), rnd (nequ)); break;
+	    case 5:  snprintf (body, sizeof (body), "add\tr%d, r%d, %d", reg (), reg (), (int) rnd (64) - 32); break;
+	    case 6:  snprintf (body, sizeof (body), "add\tr%d, r%d, r%d", reg (), reg (), reg ()); break;
+	    case 7:  snprintf (body, sizeof (body), "ld4\tr%d, [r%d + %u]", reg (), reg (), rnd (64) * 4); break;
+	    case 8:  snprintf (body, sizeof (body), "st4\t[sp + %u], r%d", rnd (16) * 8, reg ()); break;
+	    case 9:  snprintf (body, sizeof (body), "mv\tr%d, r%d", reg (), reg ()); break;
+	    case 10: snprintf (body, sizeof (body), "bne\tr%d, r%d, .L%u", reg (), reg (), rnd (nlocal)); break;
+	    case 11: snprintf (body, sizeof (body), "bz\tr%d, .L%u", reg (), rnd (nlocal)); break;
+	    case 12: snprintf (body, sizeof (body), "jal\tFN%u", rnd (nroutine)); break;
+	    case 13: snprintf (body, sizeof (body), "shl\tr%d, %u", reg (), rnd (32)); break;
+	    case 14: snprintf (body, sizeof (body), "and\tr%d, r%d, K%u & $7FFF", reg (), reg (), rnd (nequ)); break;
+	    default: snprintf (body, sizeof (body), "ld8\tr%d, [sp - %u]", reg (), 8 + rnd (16) * 8); break;
+	}
+	out (label, body);
+    }
+
+    // remaining locals and epilogue
+    while (placed < nlocal) {
+	snprintf (label, sizeof (label), ".L%u", placed++);
+	out (label, "nop");
+    }
+    out ("", "ret");
+    snprintf (body, sizeof (body), ".EQU\t-%u", 16 + rnd (8) * 16);
+    out (".FRAME", body);
+}
+
+/*
+ * data tables: words, strings and address tables
+ */
+static void table (void) {
+    char label[32];
+    snprintf (label, sizeof (label), "T%u", ntable++);
+    switch (rnd (3)) {
+	case 0:
+	    out (label, ".WORD\t1, 2, 4, 8, 16, 32, 64, 128, $100, $200, $400, $800");
+	    break;
+	case 1:
+	    out (label, ".BYTE\t\"eon synthetic workload\", 13, 10, 0");
+	    out ("", ".ALIGN\t4");
+	    break;
+	default: {
+		char body[128];
+		snprintf (body, sizeof (body), ".LONG\tFN%u, FN%u, FN%u, K%u",
+		    rnd (nroutine), rnd (nroutine), rnd (nroutine), rnd (nequ));
+		out (label, body);
+	    } break;
+    }
+}
+
+/*
+ * entry point
+ */
+int main (int argc, char **argv) {
+    if (argc < 2) {
+	fprintf (stderr,
+	    "eongen, synthetic eon source generator\n"
+	    "usage  : eongen lines [seed]\n"
+	    );
+	return 1;
+    }
+    unsigned target = strtoul (argv[1], NULL, 0);
+    if (argc > 2) seed = strtoul (argv[2], NULL, 0) | 1;
+
+    // about 24 lines per routine plus tables, every routine is referenced
+    nroutine = target / 24 + 1;
+
+    // source
+    printf ("; eongen %u lines, seed %u\n", target, seed);
+    equates (target / 50 < MAX_EQU ? target / 50 + 1 : MAX_EQU);
+    out ("", ".ORG\t$1000");
+    for (unsigned id = 0; id < nroutine; id++) {
+	routine (id);
+	if (rnd (8) == 0)
+	    table ();
+    }
+    out ("", ".END");
+    return 0;
+}
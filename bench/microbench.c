@@ -0,0 +1,217 @@
+/*
+ * microbench.c
+ *
+ * component microbenchmarks for eonasm internals
+ * the assembler is included as a single translation unit to reach its statics
+ *
+ */
+#define main eonasm_main
+#include "../eonasm.c"
+#undef main
+
+#include <stdio.h>
+
+/*
+ * config
+ */
+#define REPEAT		    7	    // runs per benchmark, median is reported
+#define MIN_NS		    10000000 // target time per run
+
+/*
+ * timing engine
+ */
+static volatile uint32_t sink;
+
+typedef void (*bench_f) (void *arg, unsigned iters);
+
+typedef struct {double median, spread;} result_t;
+
+static int cmp_double (const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return x < y ? -1 : x > y;
+}
+
+static result_t bench_run (bench_f f, void *arg, unsigned *piters) {
+    // calibrate iterations once, so runs are repeatable
+    unsigned iters = *piters;
+    if (!iters) {
+	for (iters = 1;; iters *= 2) {
+	    uint64_t t = clock_ns (CLOCK_MONOTONIC);
+	    f (arg, iters);
+	    if (clock_ns (CLOCK_MONOTONIC) - t >= MIN_NS / 8 || iters >= 1u << 30)
+		break;
+	}
+	iters *= 8;
+	*piters = iters;
+    }
+
+    // median and spread (max - min, relative to median) of REPEAT runs
+    double vns[REPEAT];
+    for (int r = 0; r < REPEAT; r++) {
+	uint64_t t = clock_ns (CLOCK_MONOTONIC);
+	f (arg, iters);
+	vns[r] = (double) (clock_ns (CLOCK_MONOTONIC) - t) / iters;
+    }
+    qsort (vns, REPEAT, sizeof (vns[0]), cmp_double);
+    double median = vns[REPEAT / 2];
+    return (result_t) {median, median > 0 ? (vns[REPEAT - 1] - vns[0]) * 100 / median : 0};
+}
+
+static void report (const char *name, bench_f f, void *arg) {
+    unsigned iters = 0;
+    result_t r	   = bench_run (f, arg, &iters);
+    printf ("%-28s %12.2f ns/op %6.1f%%\n", name, r.median, r.spread);
+}
+
+/*
+ * symbol table setup
+ */
+static char symname[32];
+
+static unsigned sym (unsigned i) {
+    return snprintf (symname, sizeof (symname), "SYM%u", i);
+}
+
+static void symbols (unsigned n) {
+    nlabel = 0;
+    nlocal = 0;
+    for (unsigned i = 0; i < n; i++)
+	add_label (NULL, symname, sym (i), i * 4, 0);
+}
+
+/*
+ * expr
+ */
+static void b_expr (void *arg, unsigned iters) {
+    uint8_t *p = arg;
+    for (unsigned i = 0; i < iters; i++)
+	sink += expr (1, &tlabel[0], false, 0x1000, p).v;
+}
+
+/*
+ * data_literal, a .BYTE/.WORD/.LONG element
+ */
+static void b_data (void *arg, unsigned iters) {
+    for (unsigned i = 0; i < iters; i++) {
+	uint8_t *p = arg;
+	uint32_t v = 0;
+	sink += data_literal (&p, &v) ? v : expr (1, NULL, false, 0x1000, p).v;
+    }
+}
+
+/*
+ * find_label
+ */
+typedef struct {unsigned n; bool hit;} fl_t;
+
+static void b_find_label (void *arg, unsigned iters) {
+    fl_t *fl = arg;
+    for (unsigned i = 0; i < iters; i++) {
+	unsigned len = sym (fl->hit ? (i * 2654435761u) % fl->n : fl->n + i % 16);
+	sink += find_label (NULL, symname, len) != NULL;
+    }
+}
+
+/*
+ * match
+ */
+static void b_match (void *arg, unsigned iters) {
+    tentry_t      e = arg;
+    struct arg_t va[3];
+    for (int n = 0; n < 3; n++)
+	va[n] = (struct arg_t) {e->args[n], 1, 4};
+    for (unsigned i = 0; i < iters; i++)
+	sink += match (e->op, e->na, va) != NULL;
+}
+
+static const char * op_name (int op) {
+    for (unsigned i = 0; i < sizeof (vop) / sizeof (vop[0]); i++)
+	if (vop[i].op == op)
+	    return vop[i].id;
+    return "?";
+}
+
+/*
+ * op_find/reg_find
+ */
+static void b_op_find (void *arg, unsigned iters) {
+    unsigned n = sizeof (vop) / sizeof (vop[0]);
+    for (unsigned i = 0; i < iters; i++)
+	sink += op_find (vop[i % n].id);
+}
+
+static void b_reg_find (void *arg, unsigned iters) {
+    unsigned n = sizeof (vreg) / sizeof (vreg[0]);
+    for (unsigned i = 0; i < iters; i++)
+	sink += reg_find (vreg[i % n].id);
+}
+
+/*
+ * emit + emit_flush, per byte
+ */
+static void b_emit (void *arg, unsigned iters) {
+    for (unsigned i = 0; i < iters; i++)
+	emit (i, i);
+    emit_flush ();
+}
+
+/*
+ * entry point
+ */
+int main (void) {
+    static const char *vexpr[][2] = {
+	{"expr/decimal",	"12345"},
+	{"expr/hex",		"$BEEF"},
+	{"expr/char",		"'x'"},
+	{"expr/pc",		"$$ + 8"},
+	{"expr/label",		"SYM7 + 4"},
+	{"expr/local",		".LOCAL + 2"},
+	{"expr/compound",	"(SYM1 + SYM2) * 2 - $10"},
+	{"expr/nested",		"((SYM3 & $FF) | (SYM4 * 16)) + 1"},
+    };
+    char name[64];
+
+    // expr over a small table with one local label
+    source = "microbench";
+    symbols (64);
+    add_label (&tlabel[0], "LOCAL", 5, 0x2000, 0);
+    for (unsigned i = 0; i < sizeof (vexpr) / sizeof (vexpr[0]); i++)
+	report (vexpr[i][0], b_expr, (void *) vexpr[i][1]);
+
+    // data elements, the literal scanner and its expr fallback
+    report ("data/decimal",	b_data, "12345, 1");
+    report ("data/hex",		b_data, "$BEEF, 1");
+    report ("data/label",	b_data, "SYM7, 1");
+
+    // find_label at growing table sizes
+    static const unsigned vsize[] = {1000, 10000, 100000};
+    for (unsigned i = 0; i < sizeof (vsize) / sizeof (vsize[0]); i++) {
+	fl_t hit  = {vsize[i], true};
+	fl_t miss = {vsize[i], false};
+	symbols (vsize[i]);
+	snprintf (name, sizeof (name), "find_label/%u/hit", vsize[i]);
+	report (name, b_find_label, &hit);
+	snprintf (name, sizeof (name), "find_label/%u/miss", vsize[i]);
+	report (name, b_find_label, &miss);
+    }
+
+    // match, every template
+    for (unsigned i = 0; i < sizeof (tmatch) / sizeof (tmatch[0]); i++) {
+	tentry_t e = &tmatch[i];
+	int	 n = snprintf (name, sizeof (name), "match/%s/", op_name (e->op));
+	for (int a = 0; a < e->na; a++)
+	    name[n++] = "_RNM"[e->args[a]];
+	name[n] = 0;
+	report (name, b_match, e);
+    }
+
+    // lookups
+    report ("op_find",  b_op_find,  NULL);
+    report ("reg_find", b_reg_find, NULL);
+
+    // emit to /dev/null
+    ofd = open ("/dev/null", O_WRONLY);
+    report ("emit", b_emit, NULL);
+    return 0;
+}
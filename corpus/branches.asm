@@ -0,0 +1,16 @@
+; options: --branches 64
+; branch distance report: per routine histogram, near limit warning, relaxed long form
+		.ORG	$1000
+START		bz	r1, .NEAR
+		bra	FAR
+		bnz	r1, NEAR
+.NEAR		li	r1, 1
+.LOOP		add	r1, r1, -1
+		bnz	r1, .LOOP
+		ret
+		.ORG	$1000 + 8 + 65500
+NEAR		bra	START
+		ret
+		.ORG	$30000
+FAR		blt	r1, r2, FAR
+		ret
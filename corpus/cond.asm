@@ -0,0 +1,26 @@
+; options: -D DEBUG=0 -D LEVEL=2
+; conditional assembly: nesting, skipped blocks, -D symbols
+		.ORG	$1000
+START		li	r1, 1
+		.IF	DEBUG
+		li	r2, $DEB
+		.IFDEF	TRACE
+		li	r3, 3
+		.ELSE
+		li	r3, 4
+		.ENDIF
+		.ELSE
+		nop
+		.IF	0
+		this line is never lexed
+		.ENDIF
+		.ENDIF
+		.IFNDEF	TRACE
+		li	r4, 5
+		.ENDIF
+		.IF	LEVEL
+		.REPT	LEVEL
+		nop
+		.ENDR
+		.ENDIF
+		ret
@@ -0,0 +1,17 @@
+; data directives and regions
+BASE		.EQU	$4000
+COUNT		.EQU	BASE / 256 + 3
+		.ORG	BASE
+TABLE		.BYTE	1, 2, 3, 'A', "text", 0
+		.ALIGN	4
+WORDS		.WORD	$1234, COUNT, TABLE, WORDS - TABLE
+LONGS		.LONG	-1, $DEADBEEF, TABLE + 8
+		.ZERO	6
+BUF		.SPACE	32
+AFTER		.BYTE	AFTER - BUF
+		.ALIGN	8
+		.ORG	$5000
+SECOND		.WORD	(1 + 2) * 3, 7 % 4, 12 & 10, 12 | 3
+		.LONG	SECOND, $$
+		.END
+ignored after .end
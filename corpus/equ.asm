@@ -0,0 +1,13 @@
+; equates in any declaration order, memoized constants, pc relative and local equates
+SIZE		.EQU	COUNT * WIDTH
+COUNT		.EQU	BASE + 2
+BASE		.EQU	6
+WIDTH		.EQU	4
+		.ORG	$1000
+START		li	r1, SIZE
+		li	r2, .END
+		li	r3, HERE
+.END		.EQU	.LAST - 2
+.LAST		ret
+HERE		.EQU	$$ + 2
+		.ZERO	COUNT
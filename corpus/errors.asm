@@ -0,0 +1,9 @@
+; diagnostics, assembly stops after pass 0
+		.ORG	$200
+DUP		nop
+DUP		nop
+		bogus	r1
+		add	r1, [r2]
+		.WHAT	1
+		li	r1, NOWHERE
+		nop	extra
@@ -0,0 +1,144 @@
+/*
+ * golden.c
+ *
+ * golden output corpus runner: assembles every source in one process with
+ * eonasm -l -u and compares image and listing against the checked-in files
+ *
+ */
+#define main eonasm_main
+#include "../eonasm.c"
+#undef main
+
+#include <stdio.h>
+#include <sys/stat.h>
+
+/*
+ * config
+ */
+#define OUTDIR		    "corpus/out"
+
+/*
+ * files
+ */
+static char * slurp (const char *path, size_t *len) {
+    int fd = open (path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    fstat (fd, &st);
+    char *p = malloc (st.st_size + 1);
+    *len    = read (fd, p, st.st_size) == st.st_size ? st.st_size : 0;
+    close (fd);
+    return p;
+}
+
+static void spill (const char *path, const char *p, size_t len) {
+    int fd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || write (fd, p, len) != (ssize_t) len) {
+	fprintf (stderr, "golden: can not write [%s]\n", path);
+	exit (2);
+    }
+    close (fd);
+}
+
+// compare (or update) expected against produced, a missing file means no output
+static bool check (const char *expect, const char *got, bool update) {
+    size_t elen = 0, glen = 0;
+    char  *e	= slurp (expect, &elen);
+    char  *g	= slurp (got, &glen);
+    bool   ok	= (!e && !g) || (e && g && elen == glen && !memcmp (e, g, elen));
+    if (!ok && update) {
+	if (g)
+	    spill (expect, g, glen);
+	else
+	    unlink (expect);
+	printf ("  updated %s\n", expect);
+	ok = true;
+    } else if (!ok) {
+	// first differing line
+	unsigned line = 1;
+	size_t	 i    = 0;
+	for (; e && g && i < elen && i < glen && e[i] == g[i]; i++)
+	    line += e[i] == '\n';
+	printf ("  %s differs at line %u (see %s)\n", expect, line, got);
+    }
+    free (e);
+    free (g);
+    return ok;
+}
+
+// extra options from a first line "; options: -x ...", split in place
+static int options (char *src, char **av) {
+    static const char tag[] = "; options:";
+    int n = 0;
+    if (!strncmp (src, tag, sizeof (tag) - 1))
+	for (char *p = strtok (src + sizeof (tag) - 1, " \t\r\n"); p && n < 8; p = strtok (NULL, " \t\r\n"))
+	    av[n++] = p;
+    return n;
+}
+
+/*
+ * entry point
+ */
+int main (int argc, char **argv) {
+    bool update = argc > 1 && !strcmp (argv[1], "-u");
+    if (update) --argc, ++argv;
+    if (argc < 2) {
+	fprintf (stderr,
+	    "golden, eonasm golden output corpus runner\n"
+	    "usage  : golden [-u] source.asm+\n"
+	    "\t-u\tupdate expected .hex/.lst files\n"
+	    );
+	return 2;
+    }
+    mkdir (OUTDIR, 0755);
+
+    uint64_t t	   = clock_ns (CLOCK_MONOTONIC);
+    unsigned fails = 0;
+    for (int i = 1; i < argc; i++) {
+	// names
+	const char *src  = argv[i];
+	const char *base = strrchr (src, '/') ? strrchr (src, '/') + 1 : src;
+	size_t	    n	 = strlen (src) - (strlen (src) > 4 && !strcmp (src + strlen (src) - 4, ".asm") ? 4 : 0);
+	char ehex[256], elst[256], ohex[256], olst[256];
+	snprintf (ehex, sizeof (ehex), "%.*s.hex", (int) n, src);
+	snprintf (elst, sizeof (elst), "%.*s.lst", (int) n, src);
+	snprintf (ohex, sizeof (ohex), OUTDIR "/%.*s.hex", (int) (n - (base - src)), base);
+	snprintf (olst, sizeof (olst), OUTDIR "/%.*s.lst", (int) (n - (base - src)), base);
+	unlink (ohex);
+
+	// assemble with stdout and stderr captured in the listing
+	fflush (stdout);
+	int so = dup (STDOUT_FILENO);
+	int se = dup (STDERR_FILENO);
+	int fd = open (olst, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	dup2 (fd, STDOUT_FILENO);
+	dup2 (fd, STDERR_FILENO);
+	size_t	len  = 0;
+	char   *text = slurp (src, &len);
+	char   *nl   = text ? memchr (text, '\n', len) : NULL;
+	if (nl) *nl = 0;
+	char   *av[16] = {"eonasm", "-l", "-u"};
+	int	ac	= 3;
+	if (nl) ac += options (text, av + ac);
+	av[ac++] = ohex;
+	av[ac++] = (char *) src;
+	int   rc   = eonasm_main (ac, av);
+	free (text);
+	dprintf (fd, "eonasm exit %d\n", rc);
+	close (fd);
+	dup2  (so, STDOUT_FILENO);
+	dup2  (se, STDERR_FILENO);
+	close (so);
+	close (se);
+
+	// compare
+	bool ok = check (ehex, ohex, update);
+	ok	= check (elst, olst, update) && ok;
+	printf ("%-32s %s\n", src, ok ? "ok" : "FAILED");
+	fails += !ok;
+    }
+
+    // summary
+    printf ("%d sources, %u failed, %.1f ms\n", argc - 1, fails, (clock_ns (CLOCK_MONOTONIC) - t) / 1e6);
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,6 @@
+; include guards: directives in any case, an .ELSE of the guard means no guard
+		.ORG	$100
+		.INCLUDE "inc/mixed.inc"
+		.INCLUDE "inc/mixed.inc"
+		.INCLUDE "inc/lower.inc"
+		.INCLUDE "inc/lower.inc"
@@ -0,0 +1,10 @@
+; .INCLUDE: cached sources, nested and guarded includes, .END in an include
+		.INCLUDE "inc/consts.inc"
+		.ORG	$1000
+START		li	r1, 'A'
+		jal	PUTC
+		li	r3, BAUD + STATUS
+		ret
+		.INCLUDE "inc/code.inc"
+		.INCLUDE "inc/consts.inc"
+DONE		ret
@@ -0,0 +1,23 @@
+; global and local labels, forward references, equates
+ONE		.EQU	1
+TWO		.EQU	ONE + ONE
+		.ORG	$100
+MAIN:		li	r1, LATER
+		bra	.LOOP
+.SKIP		nop
+.LOOP		sub	r1, r1, ONE
+		bnz	r1, .LOOP
+		bz	r1, .SKIP
+		jal	HELPER
+		lea	r2, .DATA
+		ret
+.DATA		.BYTE	TWO, .LOOP - MAIN
+		.ALIGN	2
+HELPER		enter	.FRAME
+.LOOP		ld8	r3, [sp + .OFF]
+		bne	r3, r0, .LOOP
+		ret
+.FRAME		.EQU	-64
+.OFF		.EQU	8
+LATER		.WORD	HELPER - MAIN
+UNUSED		nop
@@ -0,0 +1,7 @@
+; data tables: literal scanner, expr fallback per element, full lines of .LONG
+		.ORG	$2000
+TABLE		.LONG	1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0,1,2,3,4,5,6,7,8,9,0
+BYTES		.BYTE	$7f, 'A', 10 , "hi", 2 * 3, END - TABLE
+WORDS		.WORD	$BEEF, -2 & $FFFF, 65535 ; comment
+		.LONG	$DEADBEEF,TABLE,-1
+END		.BYTE	0
@@ -0,0 +1,14 @@
+; options: -A 8 -O
+; loop head alignment with nop, backward targets only, jmp relaxed to bra
+		.ORG	$1000
+START		li	r1, 10
+		nop
+.LOOP		sub	r1, r1, 1
+		bnz	r1, .LOOP
+		li	r2, 3
+OUTER		add	r2, r2, -1
+.IN		nop
+		bra	.IN
+		beq	r1, r2, OUTER
+		jmp	START
+		ret
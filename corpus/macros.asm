@@ -0,0 +1,20 @@
+; macros: params, unique labels, nested expansion
+		.MACRO	PUSH2 ra, rb
+		st4	[sp - 4], \ra
+		st4	[sp - 8], \rb
+		sub	sp, sp, 8
+		.ENDM
+		.MACRO	DELAY n
+		li	r9, \n
+.W\@		sub	r9, r9, 1
+		bnz	r9, .W\@
+		.ENDM
+		.MACRO	TWICE n
+		DELAY	\n
+		DELAY	\n * 2
+		.ENDM
+		.ORG	$1000
+START		PUSH2	r1, r2
+		DELAY	10
+		TWICE	3	; nested
+		ret
@@ -0,0 +1,129 @@
+; every opcode template
+		.ORG	$2000
+START		add	r1, r2, r3
+		add	r1, r2, 100
+		add	r1, -7
+		add	r1, r2
+		and	r1, r2, r3
+		and	r1, r2, $FF
+		and	r1, $F0
+		and	r1, r2
+		beq	r1, r2, START
+		ble	r1, r2, START
+		blei	r1, r2, FWD
+		blt	r1, r2, FWD
+		blti	r1, r2, START
+		bne	r1, r2, FWD
+		bnz	r3, START
+		bra	FWD
+		bswap	r1, r2
+		bswap	r4
+		bz	r3, FWD
+		csetn	r1, r2
+		csetn	r1
+		csetnn	r1, r2
+		csetnn	r1
+		csetnp	r1, r2
+		csetnp	r1
+		csetnz	r1, r2
+		csetnz	r1
+		csetp	r1, r2
+		csetp	r1
+		csetz	r1, r2
+		csetz	r1
+		div	r1, r2, r3
+		div	r1, r2, 3
+		div	r1, 3
+		div	r1, r2
+		enter	-32
+		eret
+		get	r5, 3
+FWD		idiv	r1, r2, r3
+		idiv	r1, r2, 3
+		idiv	r1, 3
+		idiv	r1, r2
+		illegal
+		imul	r1, r2, r3
+		imul	r1, r2, 3
+		imul	r1, 3
+		imul	r1, r2
+		in	r1, r2
+		inv	r1, 64
+		iret
+		istat	r6
+		jal	START
+		jal	r7
+		jmp	FAR
+		jmp	r7
+		ld1	r1, [r2 + 4]
+		ld1i	r1, [r2 - 4]
+		ld2	r1, [r2]
+		ld2i	r1, [sp + 2]
+		ld4	r1, [r2 + 8]
+		ld4i	r1, [r2 + 8]
+		ld8	r1, [sp - 16]
+		lea	r1, FAR
+		lea	r1, [sp + 24]
+		lea	r1, [r2 + 24]
+		li	r1, 0
+		li	r1, 1
+		li	r1, -2
+		li	r1, 32767
+		li	r1, 32768
+		li	r1, -32769
+		li	r1, $12345678
+		mul	r1, r2, r3
+		mul	r1, r2, 5
+		mul	r1, 5
+		mul	r1, r2
+		mv	r1, r2
+		nop
+		or	r1, r2, r3
+		or	r1, r2, 1
+		or	r1, 1
+		or	r1, r2
+		out	r1, r2
+		ret
+		set	4, r9
+		sext1	r1, r2
+		sext1	r1
+		sext2	r1, r2
+		sext2	r1
+		sext4	r1, r2
+		sext4	r1
+		shl	r1, r2, r3
+		shl	r1, r2, 2
+		shl	r1, 2
+		shl	r1, r2
+		shr	r1, r2, r3
+		shr	r1, r2, 2
+		shr	r1, 2
+		shr	r1, r2
+		shri	r1, r2, r3
+		shri	r1, r2, 2
+		shri	r1, 2
+		shri	r1, r2
+		signal	9
+		sret
+		st1	[r2 + 1], r1
+		st2	[r2 + 2], r1
+		st4	[sp - 4], r1
+		st8	[r2], r1
+		sub	r1, r2, r3
+		sub	r1, r2, 9
+		sub	r1, 9
+		sub	r1, r2
+		syscall
+		wait
+		xor	r1, r2, r3
+		xor	r1, r2, -1
+		xor	r1, -1
+		xor	r1, r2
+		zext1	r1, r2
+		zext1	r1
+		zext2	r1, r2
+		zext2	r1
+		zext4	r1, r2
+		zext4	r1
+		.ORG	$3000
+FAR		ret
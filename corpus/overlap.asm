@@ -0,0 +1,7 @@
+; options: -S X=$1002
+; overlapping sections are an error on the last pass
+		.ORG	$1000
+START		nop
+		nop
+		.SECTION X
+		nop
@@ -0,0 +1,12 @@
+; options: -O
+; peephole rewrites: a source 15 reads as zero, a size that depends on labels converges
+		.ORG	$1000
+START		add	r1, sp, 0
+		xor	r2, sp, 0
+		mul	r4, sp, 1
+		add	r3, r3, 0
+		sub	r5, r6, 0
+		and	r7, r8, 0
+S		add	r2, r2, -4 + E - S
+E		lea	r9, START
+		ret
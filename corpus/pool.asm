@@ -0,0 +1,26 @@
+; options: -P r13
+; literal pool: dedup by value and by text, 3 uses to pool, one literal per value of a text
+BIG		.EQU	$12345678
+		.ORG	$1000
+START		lea	r13, LITS
+		li	r1, BIG
+		li	r2, BIG
+		li	r3, $12345678
+		li	r4, FAR
+		li	r5, FAR
+		li	r6, FAR + 4
+		li	r7, $DEADBEEF
+.LOOP		li	r9, .LOOP + $20000
+		li	r9, .LOOP + $20000
+		li	r9, .LOOP + $20000
+		li	r10, 30000
+		.REPT	4, I
+		li	r11, FAR + I * 65536
+		li	r11, FAR + I * 65536
+		li	r11, FAR + I * 65536
+		.ENDR
+		bra	.LOOP
+LITS		.POOL
+		.ORG	$40000
+FAR		nop
+		.END
@@ -0,0 +1,16 @@
+; re-evaluation: a .REPT count that changes shifts statement numbers, cached encodings stay exact
+start:		bra	far
+mid:
+		.REPT	(mid - start) - 4
+		nop
+		.ENDR
+		li	r1, grow1
+		li	r3, 5
+		li	r2, late
+		nop
+		nop
+		.SPACE	32744
+late:		nop
+		.SPACE	32772
+grow1:		nop
+far:		ret
@@ -0,0 +1,26 @@
+; .REPT: iteration symbol, nesting, inside macros, zero count
+		.ORG	$1000
+COPY		.REPT	4, I
+		ld4	r1, [r2 + I * 4]
+		st4	[r3 + I * 4], r1
+		.ENDR
+		ret
+SQUARES 	.REPT	8, N
+		.BYTE	N * N
+		.ENDR
+GRID		.REPT	2, R
+		.REPT	3, C
+		.BYTE	C + R * 16
+		.ENDR
+		.ENDR
+		.MACRO	CLEAR n
+		.REPT	\n
+		st4	[r3 + 0], r1
+		.ENDR
+		.ENDM
+		CLEAR	2
+		CLEAR	3
+		.REPT	0
+		nop
+		.ENDR
+		ret
@@ -0,0 +1,16 @@
+; options: -S COLD=$20000
+; sections: per section pc, chained origins, cross section branch relaxation
+		.ORG	$1000
+START		li	r1, 5
+		bz	r1, FAIL
+		blt	r1, r2, INIT
+		bra	DONE
+		.COLD
+FAIL		li	r1, -1
+		ret
+		.HOT
+DONE		ret
+		.SECTION INIT
+INIT		li	r2, 1
+		beq	r1, r2, START
+		ret
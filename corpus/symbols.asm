@@ -0,0 +1,10 @@
+; options: --symbols corpus/inc/consts.sym
+; symbol snapshot: predefined equates, the guarded include is skipped
+		.INCLUDE "inc/consts.inc"
+		.ORG	$2000
+START		li	r1, UART
+		li	r2, BAUD + STATUS
+		.IFDEF	CONSTS_INC
+		li	r3, CONSTS_INC
+		.ENDIF
+		ret
@@ -0,0 +1,19 @@
+; options: -T
+; tail call fusion and branch threading
+		.ORG	$1000
+START		li	r1, 3
+		jal	WORK
+		ret
+WORK		bz	r1, .OUT
+		bnz	r1, .AGAIN
+		jal	r3
+		ret
+.AGAIN		bra	.LOOP
+.LOOP		add	r1, r1, -1
+		jal	LEAF
+.OUT
+		ret
+LEAF		bra	.DONE
+		nop
+.DONE		jmp	EXIT
+EXIT		ret
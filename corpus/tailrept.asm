@@ -0,0 +1,14 @@
+; options: -T
+; -T with a .REPT count that changes between passes, fusion follows the instructions
+START		bz	r1, FAR
+MID		.REPT	(MID - START) / 4
+		nop
+		.ENDR
+		jal	X
+		ret
+		li	r1, 1
+		li	r2, 2
+		li	r3, 3
+X		ret
+		.ORG	$30000
+FAR		nop
@@ -0,0 +1,15 @@
+; options: --strip-unreachable
+; unreachable runs after unconditional transfers, ended by labels and directives
+		.ORG	$1000
+START		bz	r1, .SKIP
+		bra	.SKIP
+		li	r1, 2
+		nop
+.SKIP		jmp	r3
+		add	r1, r1, 1
+		ret
+		.BYTE	1, 2
+		.ALIGN	2
+TAIL		li	r2, 7
+		iret
+		sret
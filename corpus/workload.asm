@@ -0,0 +1,2011 @@
+; eongen 2000 lines, seed 2022
+K0	.EQU	760
+K1	.EQU	(K0 + 47) & $FFFF
+K2	.EQU	K0 * 2 - K1
+K3	.EQU	K2 + 43
+K4	.EQU	K3 + 51
+K5	.EQU	K3 * 2 - K1
+K6	.EQU	$3029
+K7	.EQU	K5 * 2 - K1
+K8	.EQU	(K7 + 29) & $FFFF
+K9	.EQU	(K6 + 36) & $FFFF
+K10	.EQU	K9 + 67
+K11	.EQU	(K6 + 53) & $FFFF
+K12	.EQU	K11 * 2 - K10
+K13	.EQU	K10 * 2 - K5
+K14	.EQU	K0 * 2 - K3
+K15	.EQU	(K5 + 20) & $FFFF
+K16	.EQU	K15 + 33
+K17	.EQU	$E3FD
+K18	.EQU	(K4 + 50) & $FFFF
+K19	.EQU	K18 + 66
+K20	.EQU	$7037
+K21	.EQU	(K0 + 14) & $FFFF
+K22	.EQU	$2696
+K23	.EQU	K3 * 2 - K9
+K24	.EQU	K20 * 2 - K2
+K25	.EQU	$50AE
+K26	.EQU	(K7 + 38) & $FFFF
+K27	.EQU	(K15 + 8) & $FFFF
+K28	.EQU	K23 * 2 - K4
+K29	.EQU	K20 * 2 - K4
+K30	.EQU	K19 * 2 - K22
+K31	.EQU	K30 + 11
+K32	.EQU	(K15 + 40) & $FFFF
+K33	.EQU	$4F41
+K34	.EQU	K33 + 27
+K35	.EQU	K34 + 53
+K36	.EQU	(K8 + 45) & $FFFF
+K37	.EQU	$8988
+K38	.EQU	(K9 + 19) & $FFFF
+K39	.EQU	(K24 + 40) & $FFFF
+K40	.EQU	K13 * 2 - K11
+	.ORG	$1000
+FN0	enter	.FRAME
+.L0	bz	r5, .L0
+	add	r6, r2, r8
+	st4	[sp + 48], r12
+	li	r10, K19
+	li	r0, K40
+	li	r4, FN72
+	li	r9, -756
+.L1	li	r9, $6C2A8565
+	mv	r7, r1
+	bz	r5, .L0
+	st4	[sp + 16], r13
+	bz	r9, .L1
+	mv	r1, r10
+	li	r9, FN30
+.L2	mv	r12, r3
+	li	r5, -701
+	li	r12, 375
+	li	r13, 0
+	add	r0, r8, 28
+	ld8	r10, [sp - 80]
+	li	r11, K29
+	ret
+.FRAME	.EQU	-48
+FN1	enter	.FRAME
+.L0	bz	r9, .L4
+	li	r2, FN45
+	li	r11, 0
+.L1	add	r12, r7, -10
+	li	r1, K11
+	bz	r3, .L3
+	ld4	r4, [r5 + 28]
+.L2	li	r2, K14
+	li	r1, $4B0E8A81
+	shl	r7, 16
+	st4	[sp + 96], r4
+.L3	and	r8, r9, K14 & $7FFF
+	add	r10, r6, r9
+	and	r2, r12, K27 & $7FFF
+	bz	r5, .L1
+.L4	li	r0, FN24
+	li	r2, FN48
+	mv	r3, r13
+.L5	li	r10, 1
+	shl	r8, 28
+	and	r12, r1, K40 & $7FFF
+	li	r6, K4
+.L6	li	r9, 932
+	li	r2, -51
+	and	r5, r4, K30 & $7FFF
+	mv	r5, r9
+.L7	mv	r12, r2
+	mv	r6, r9
+	li	r4, FN45
+	st4	[sp + 112], r3
+	ret
+.FRAME	.EQU	-48
+FN2	enter	.FRAME
+.L0	bz	r7, .L0
+	mv	r3, r9
+	li	r8, K8
+	and	r5, r12, K32 & $7FFF
+	ld8	r7, [sp - 16]
+	bne	r10, r6, .L0
+	st4	[sp + 16], r2
+	and	r11, r7, K18 & $7FFF
+	li	r13, $761BA010
+	ld4	r5, [r4 + 72]
+	li	r12, $3906BF6E
+	shl	r5, 17
+	add	r5, r0, 21
+	ld4	r3, [r13 + 180]
+	li	r11, K0
+	bne	r7, r13, .L0
+	ld8	r9, [sp - 80]
+	bne	r1, r7, .L0
+	jal	FN68
+	li	r4, FN27
+	li	r12, $5998F7AB
+	li	r5, $3E1A91A5
+	bz	r2, .L0
+	li	r11, K26
+	ld8	r11, [sp - 104]
+	li	r1, $5B31CDC2
+	li	r3, -926
+	ret
+.FRAME	.EQU	-128
+FN3	enter	.FRAME
+.L0	mv	r3, r0
+	add	r9, r9, -3
+.L1	li	r13, $3F34D2E
+	and	r8, r8, K5 & $7FFF
+.L2	mv	r1, r3
+	mv	r1, r8
+	add	r11, r6, r4
+.L3	li	r7, FN47
+	bne	r5, r5, .L1
+.L4	shl	r5, 15
+	ld8	r13, [sp - 48]
+	ld4	r11, [r11 + 0]
+	ret
+.FRAME	.EQU	-112
+FN4	enter	.FRAME
+.L0	li	r5, -725
+	li	r5, -989
+.L1	bz	r5, .L2
+	bne	r9, r5, .L5
+.L2	ld8	r2, [sp - 104]
+	mv	r4, r11
+.L3	st4	[sp + 0], r8
+	li	r6, FN56
+	bz	r11, .L4
+.L4	li	r10, FN52
+	li	r9, 107
+.L5	and	r3, r3, K12 & $7FFF
+	mv	r13, r2
+.L6	ld4	r2, [r7 + 216]
+	li	r13, FN28
+	bz	r12, .L5
+	ret
+.FRAME	.EQU	-64
+FN5	enter	.FRAME
+.L0	jal	FN61
+.L1	li	r7, FN31
+.L2	add	r6, r2, 9
+.L3	and	r9, r5, K10 & $7FFF
+	li	r0, $1443A25
+.L4	li	r13, K20
+.L5	li	r12, -687
+.L6	ld4	r3, [r0 + 84]
+	add	r10, r12, 16
+	ret
+.FRAME	.EQU	-112
+FN6	enter	.FRAME
+.L0	add	r13, r2, 31
+	li	r8, K28
+	mv	r11, r4
+	li	r4, 0
+	bz	r8, .L0
+	mv	r9, r4
+	ld8	r12, [sp - 96]
+	and	r9, r11, K3 & $7FFF
+	add	r1, r7, r8
+	bz	r3, .L1
+	and	r1, r9, K26 & $7FFF
+	add	r3, r10, 21
+	jal	FN22
+	bz	r7, .L1
+.L1	ld4	r9, [r12 + 52]
+	li	r1, FN10
+	bz	r13, .L0
+	jal	FN68
+	st4	[sp + 48], r11
+	li	r4, -497
+	and	r13, r1, K27 & $7FFF
+	li	r1, 957
+	li	r8, -560
+	ld4	r12, [r4 + 212]
+	li	r7, K26
+	li	r3, FN57
+	ld4	r2, [r1 + 120]
+	add	r3, r9, 20
+	ret
+.FRAME	.EQU	-128
+FN7	enter	.FRAME
+.L0	and	r12, r1, K7 & $7FFF
+	add	r5, r6, r11
+	ld4	r9, [r6 + 104]
+	bz	r11, .L0
+	li	r8, FN36
+	li	r8, FN16
+	ld4	r7, [r2 + 160]
+	ld8	r1, [sp - 80]
+	ld8	r7, [sp - 64]
+	shl	r6, 22
+	and	r10, r13, K4 & $7FFF
+	shl	r5, 24
+	li	r3, $99C38FB
+	li	r6, K22
+	st4	[sp + 64], r10
+	mv	r8, r5
+	mv	r3, r12
+	li	r4, K3
+	add	r1, r4, r0
+	shl	r12, 12
+	li	r13, -367
+	shl	r0, 13
+	st4	[sp + 96], r11
+	li	r5, FN42
+	st4	[sp + 96], r9
+	li	r11, 941
+	mv	r1, r6
+	li	r10, FN3
+	ret
+.FRAME	.EQU	-128
+FN8	enter	.FRAME
+.L0	ld8	r7, [sp - 16]
+	ld8	r8, [sp - 96]
+	ld8	r6, [sp - 40]
+	add	r10, r11, r12
+	ld8	r4, [sp - 24]
+.L1	li	r12, K32
+	ld4	r0, [r6 + 4]
+	li	r6, FN69
+	ld4	r4, [r1 + 244]
+	li	r11, 0
+.L2	li	r13, FN20
+	bz	r8, .L3
+	mv	r9, r5
+	bne	r2, r4, .L1
+	and	r0, r1, K30 & $7FFF
+.L3	ld4	r8, [r4 + 144]
+	ld8	r0, [sp - 56]
+	bne	r9, r6, .L4
+	li	r7, K2
+	add	r4, r11, r12
+.L4	ld8	r5, [sp - 16]
+	li	r1, K15
+	st4	[sp + 40], r11
+	shl	r8, 25
+	mv	r0, r9
+	st4	[sp + 56], r1
+	ret
+.FRAME	.EQU	-48
+FN9	enter	.FRAME
+.L0	bne	r0, r4, .L0
+	bne	r1, r0, .L0
+	ld8	r0, [sp - 64]
+	add	r4, r10, 29
+	li	r4, 906
+	ld4	r4, [r7 + 148]
+	li	r2, K35
+	shl	r2, 8
+	li	r7, K2
+	add	r3, r1, 11
+	ld8	r3, [sp - 8]
+	li	r11, FN40
+	li	r8, FN70
+	jal	FN20
+.L1	add	r5, r11, 20
+	jal	FN59
+	ld8	r12, [sp - 96]
+	add	r13, r13, r10
+	add	r6, r5, r9
+	li	r5, $547C5960
+	bz	r13, .L1
+	li	r13, K23
+	li	r3, -198
+	li	r6, K32
+	ld8	r6, [sp - 56]
+	jal	FN61
+	bz	r13, .L0
+	add	r4, r10, -10
+	ret
+.FRAME	.EQU	-80
+FN10	enter	.FRAME
+.L0	jal	FN78
+.L1	ld8	r13, [sp - 32]
+.L2	li	r3, 0
+	st4	[sp + 64], r9
+.L3	li	r12, K39
+.L4	li	r7, -67
+.L5	mv	r11, r0
+	ld8	r2, [sp - 32]
+	ret
+.FRAME	.EQU	-128
+FN11	enter	.FRAME
+.L0	jal	FN59
+	add	r1, r4, r13
+	li	r13, K4
+	ld8	r11, [sp - 72]
+.L1	li	r6, 0
+	ld8	r11, [sp - 96]
+	li	r5, FN61
+	bne	r6, r0, .L2
+.L2	shl	r2, 2
+	li	r5, $44FA03F4
+	bne	r8, r13, .L2
+	bz	r5, .L5
+.L3	ld8	r7, [sp - 64]
+	st4	[sp + 120], r8
+	bz	r7, .L5
+	li	r13, FN13
+.L4	mv	r10, r12
+	li	r13, 1
+	li	r1, -337
+	ld4	r1, [r3 + 52]
+.L5	li	r4, -773
+	li	r5, 1
+	jal	FN56
+	li	r5, 594
+	and	r11, r0, K28 & $7FFF
+	ret
+.FRAME	.EQU	-64
+FN12	enter	.FRAME
+.L0	ld8	r1, [sp - 56]
+	bne	r4, r9, .L3
+	bne	r5, r13, .L0
+.L1	li	r1, 0
+	add	r9, r6, -10
+	li	r2, -907
+	li	r10, K1
+.L2	li	r8, $24C33378
+	add	r2, r8, r11
+	li	r5, FN66
+	mv	r11, r3
+.L3	add	r7, r0, 30
+	shl	r9, 8
+	ld4	r4, [r2 + 128]
+	li	r5, 0
+.L4	ld8	r6, [sp - 96]
+	ld4	r7, [r10 + 60]
+	li	r2, 932
+	st4	[sp + 64], r2
+.L5	bne	r7, r5, .L3
+	li	r9, K39
+	ld4	r10, [r4 + 20]
+	li	r10, K25
+	ret
+.FRAME	.EQU	-32
+FN13	enter	.FRAME
+.L0	shl	r7, 17
+	st4	[sp + 120], r1
+.L1	shl	r3, 17
+	li	r9, $6DBE57E7
+	li	r1, 1
+.L2	bne	r10, r9, .L0
+	li	r13, K27
+	li	r9, -963
+.L3	and	r8, r9, K8 & $7FFF
+	li	r1, FN61
+	li	r0, K12
+	ret
+.FRAME	.EQU	-80
+FN14	enter	.FRAME
+.L0	shl	r10, 26
+	li	r12, $320DAE77
+.L1	li	r7, FN71
+	and	r5, r5, K30 & $7FFF
+	add	r6, r13, 30
+.L2	li	r5, K10
+	shl	r8, 2
+.L3	li	r4, 392
+	and	r10, r7, K28 & $7FFF
+	mv	r12, r2
+	ret
+.FRAME	.EQU	-96
+FN15	enter	.FRAME
+.L0	bne	r13, r1, .L3
+	add	r6, r12, 1
+	st4	[sp + 72], r7
+	bne	r6, r9, .L0
+	jal	FN51
+	li	r6, K27
+.L1	shl	r10, 26
+	li	r7, FN6
+	ld4	r8, [r0 + 16]
+	li	r3, $1E7F1308
+	li	r11, -32
+	li	r12, 1
+	st4	[sp + 96], r3
+.L2	mv	r0, r8
+	ld8	r1, [sp - 48]
+	shl	r13, 21
+	add	r3, r7, r7
+	li	r3, -611
+	ld4	r8, [r13 + 240]
+.L3	ld4	r4, [r7 + 200]
+	ld4	r4, [r12 + 248]
+	ld4	r9, [r6 + 40]
+	jal	FN37
+	ld8	r2, [sp - 120]
+	add	r0, r10, r13
+	li	r8, $5048C621
+	ret
+.FRAME	.EQU	-80
+T0	.LONG	FN10, FN65, FN27, K39
+FN16	enter	.FRAME
+.L0	li	r12, K7
+	st4	[sp + 80], r9
+	add	r2, r3, 29
+	bne	r12, r12, .L1
+	li	r8, K36
+.L1	li	r13, K4
+	shl	r2, 16
+	li	r0, 93
+	st4	[sp + 48], r4
+	li	r0, $2BCA7A31
+	ld8	r11, [sp - 64]
+.L2	li	r3, FN62
+	add	r3, r12, r10
+	ld8	r5, [sp - 120]
+	ld4	r13, [r2 + 128]
+	li	r8, FN25
+.L3	li	r5, 162
+	bne	r13, r2, .L3
+	add	r4, r5, r8
+	st4	[sp + 80], r3
+	bz	r5, .L0
+	add	r10, r3, 8
+	ret
+.FRAME	.EQU	-128
+FN17	enter	.FRAME
+.L0	st4	[sp + 40], r12
+.L1	ld4	r2, [r2 + 184]
+.L2	ld4	r10, [r12 + 52]
+.L3	ld8	r12, [sp - 24]
+.L4	mv	r7, r3
+.L5	add	r1, r9, -27
+.L6	shl	r1, 29
+.L7	add	r5, r2, r6
+	li	r1, FN9
+	ret
+.FRAME	.EQU	-80
+FN18	enter	.FRAME
+.L0	ld8	r8, [sp - 32]
+	mv	r8, r12
+	li	r3, -36
+	li	r7, 0
+	ld8	r0, [sp - 128]
+	li	r9, $4079BC08
+	bz	r0, .L1
+	jal	FN46
+	st4	[sp + 24], r2
+.L1	ld8	r9, [sp - 88]
+	mv	r9, r9
+	mv	r2, r3
+	and	r4, r4, K40 & $7FFF
+	add	r10, r13, r12
+	ld4	r13, [r1 + 240]
+	li	r8, 0
+	li	r13, 150
+	bne	r3, r10, .L2
+.L2	ld4	r2, [r6 + 104]
+	li	r11, $25DE7843
+	li	r4, FN59
+	and	r13, r3, K36 & $7FFF
+	shl	r8, 24
+	li	r7, 0
+	bz	r2, .L1
+	mv	r7, r10
+	ld8	r9, [sp - 104]
+	mv	r11, r8
+	ret
+.FRAME	.EQU	-48
+T1	.WORD	1, 2, 4, 8, 16, 32, 64, 128, $100, $200, $400, $800
+FN19	enter	.FRAME
+.L0	ld8	r6, [sp - 80]
+	li	r9, -448
+	st4	[sp + 40], r5
+.L1	li	r7, -846
+	li	r6, FN29
+	ld8	r6, [sp - 96]
+	bz	r4, .L0
+.L2	ld4	r1, [r10 + 192]
+	li	r0, $1DC9D673
+	ld4	r6, [r4 + 76]
+.L3	mv	r12, r12
+	li	r12, K10
+	ld8	r2, [sp - 32]
+	shl	r5, 4
+	ret
+.FRAME	.EQU	-112
+FN20	enter	.FRAME
+.L0	shl	r7, 15
+.L1	ld8	r6, [sp - 64]
+.L2	li	r12, K29
+	bne	r9, r5, .L5
+.L3	jal	FN63
+.L4	bz	r10, .L3
+.L5	st4	[sp + 80], r5
+	and	r12, r6, K0 & $7FFF
+.L6	jal	FN74
+.L7	and	r5, r9, K40 & $7FFF
+	li	r4, $3A89B496
+	ret
+.FRAME	.EQU	-48
+FN21	enter	.FRAME
+.L0	bne	r3, r8, .L0
+	ld4	r12, [r13 + 100]
+	add	r4, r2, r8
+.L1	and	r8, r5, K11 & $7FFF
+	mv	r5, r12
+	mv	r12, r9
+	ld4	r13, [r2 + 148]
+.L2	shl	r2, 6
+	ld4	r5, [r12 + 112]
+	mv	r1, r13
+	li	r5, FN22
+.L3	li	r8, -388
+	st4	[sp + 40], r1
+	and	r13, r10, K23 & $7FFF
+	shl	r9, 27
+.L4	ld8	r10, [sp - 56]
+	jal	FN31
+	ld4	r10, [r6 + 140]
+	li	r1, $34EC9A7D
+.L5	st4	[sp + 0], r8
+	li	r4, K7
+	jal	FN45
+	bz	r0, .L0
+.L6	li	r11, -431
+	jal	FN13
+	ld4	r9, [r6 + 120]
+	jal	FN76
+.L7	bz	r2, .L1
+	bz	r3, .L0
+	jal	FN50
+	li	r2, $4AA12075
+	ret
+.FRAME	.EQU	-32
+T2	.WORD	1, 2, 4, 8, 16, 32, 64, 128, $100, $200, $400, $800
+FN22	enter	.FRAME
+.L0	li	r1, FN2
+	shl	r1, 13
+	li	r10, K30
+	ld4	r9, [r9 + 116]
+	li	r6, 1
+.L1	li	r11, 499
+	li	r0, 571
+	add	r5, r12, r7
+	li	r9, 1
+	li	r4, $165932A0
+.L2	add	r3, r13, -15
+	and	r2, r5, K26 & $7FFF
+	jal	FN15
+	st4	[sp + 72], r4
+	st4	[sp + 16], r12
+.L3	li	r13, $4A805EDB
+	ld8	r2, [sp - 120]
+	bz	r2, .L2
+	add	r10, r0, 8
+	ld4	r4, [r2 + 120]
+	ret
+.FRAME	.EQU	-80
+T3	.LONG	FN4, FN71, FN26, K22
+FN23	enter	.FRAME
+.L0	shl	r5, 23
+	add	r2, r1, r11
+	jal	FN2
+	ld8	r1, [sp - 16]
+.L1	st4	[sp + 8], r4
+	bz	r7, .L1
+	bne	r13, r13, .L0
+	li	r12, 543
+	ret
+.FRAME	.EQU	-96
+FN24	enter	.FRAME
+.L0	ld8	r4, [sp - 104]
+	mv	r10, r1
+	add	r3, r0, r4
+	shl	r9, 5
+.L1	li	r4, $1779C9E
+	bz	r3, .L3
+	and	r8, r7, K13 & $7FFF
+	mv	r1, r0
+.L2	jal	FN13
+	li	r12, 785
+	ld8	r11, [sp - 72]
+	bne	r6, r6, .L0
+.L3	jal	FN73
+	li	r11, $4701C6BC
+	li	r12, 145
+	jal	FN55
+.L4	li	r8, K25
+	li	r8, $2871D033
+	mv	r5, r9
+	add	r11, r5, r9
+.L5	li	r7, -424
+	li	r9, -948
+	li	r8, 0
+	ld4	r1, [r5 + 0]
+	jal	FN76
+	ret
+.FRAME	.EQU	-112
+FN25	enter	.FRAME
+.L0	ld4	r8, [r0 + 228]
+	li	r9, 598
+	jal	FN71
+	and	r2, r5, K6 & $7FFF
+	jal	FN35
+	li	r10, $6DAE3413
+	li	r4, 1
+	jal	FN17
+	li	r5, 1
+.L1	li	r1, 0
+	st4	[sp + 120], r2
+	li	r1, $645F6580
+	li	r10, $71BC85AF
+	bz	r3, .L1
+	jal	FN12
+	bne	r4, r3, .L1
+	ld4	r10, [r6 + 112]
+	st4	[sp + 64], r2
+	bne	r13, r9, .L1
+	ret
+.FRAME	.EQU	-80
+FN26	enter	.FRAME
+.L0	li	r10, FN27
+	li	r13, K15
+.L1	li	r10, FN3
+	li	r11, $819BF8E
+.L2	ld4	r10, [r0 + 144]
+	mv	r13, r1
+	bne	r3, r8, .L0
+.L3	ld4	r10, [r7 + 164]
+	bz	r2, .L2
+.L4	li	r12, $7C57B227
+	mv	r2, r1
+.L5	li	r0, 0
+	and	r9, r6, K32 & $7FFF
+	add	r2, r9, r7
+	ret
+.FRAME	.EQU	-96
+FN27	enter	.FRAME
+.L0	jal	FN44
+	ld4	r1, [r12 + 104]
+	li	r12, -386
+	jal	FN80
+	add	r6, r8, -29
+	li	r9, -571
+	li	r4, $73E92469
+	jal	FN47
+.L1	mv	r2, r11
+	add	r0, r11, r1
+	mv	r10, r6
+	add	r0, r3, r7
+	st4	[sp + 104], r2
+	bz	r2, .L1
+	bne	r8, r2, .L0
+	add	r2, r6, -21
+.L2	add	r2, r7, 24
+	ld8	r10, [sp - 8]
+	add	r10, r12, r8
+	add	r3, r9, r9
+	bne	r12, r13, .L1
+	jal	FN55
+	add	r6, r7, r4
+	bz	r2, .L2
+	ret
+.FRAME	.EQU	-32
+FN28	enter	.FRAME
+.L0	li	r0, 1
+	bne	r6, r0, .L2
+	mv	r6, r13
+	st4	[sp + 0], r0
+	add	r8, r13, 7
+	bne	r11, r9, .L1
+	st4	[sp + 32], r7
+	mv	r2, r9
+	jal	FN2
+.L1	and	r2, r13, K28 & $7FFF
+	li	r9, 0
+	mv	r12, r12
+	li	r10, 916
+	jal	FN21
+	li	r2, 410
+	bne	r10, r1, .L2
+	li	r9, K24
+	shl	r8, 8
+.L2	li	r9, FN35
+	mv	r1, r5
+	li	r3, K33
+	li	r8, 0
+	ld8	r8, [sp - 104]
+	mv	r10, r7
+	ld8	r6, [sp - 88]
+	li	r2, FN69
+	jal	FN60
+	li	r9, FN60
+	ret
+.FRAME	.EQU	-80
+FN29	enter	.FRAME
+.L0	shl	r1, 3
+	bne	r6, r12, .L4
+	st4	[sp + 16], r10
+	li	r12, $67CD29E7
+.L1	and	r12, r0, K8 & $7FFF
+	li	r6, 0
+	jal	FN69
+	li	r10, 0
+	li	r12, $75883325
+.L2	shl	r5, 16
+	mv	r0, r11
+	shl	r6, 27
+	li	r3, -722
+	shl	r3, 31
+.L3	add	r8, r3, r7
+	shl	r4, 15
+	add	r13, r13, r11
+	shl	r4, 22
+	ld4	r3, [r8 + 0]
+.L4	li	r7, $A419757
+	bne	r6, r7, .L0
+	st4	[sp + 72], r9
+	add	r9, r0, 26
+	li	r9, -502
+	ret
+.FRAME	.EQU	-80
+FN30	enter	.FRAME
+.L0	shl	r5, 19
+.L1	bz	r0, .L0
+	jal	FN37
+.L2	and	r8, r9, K35 & $7FFF
+.L3	li	r11, 1
+	jal	FN15
+.L4	and	r13, r0, K15 & $7FFF
+.L5	and	r7, r9, K16 & $7FFF
+	st4	[sp + 112], r7
+.L6	ld4	r3, [r4 + 224]
+	add	r6, r6, 4
+	ret
+.FRAME	.EQU	-112
+FN31	enter	.FRAME
+.L0	add	r9, r11, r8
+	and	r6, r4, K32 & $7FFF
+	ld8	r0, [sp - 16]
+	add	r13, r1, r1
+.L1	add	r7, r13, 19
+	add	r4, r7, r0
+	mv	r13, r6
+	li	r8, -664
+	li	r4, K21
+.L2	li	r8, $4A9E17C2
+	ld8	r6, [sp - 80]
+	li	r4, $4F5DE15F
+	ld8	r1, [sp - 104]
+	jal	FN81
+	ret
+.FRAME	.EQU	-32
+FN32	enter	.FRAME
+.L0	st4	[sp + 80], r3
+.L1	ld8	r9, [sp - 88]
+.L2	jal	FN65
+.L3	li	r12, 0
+	li	r8, $18558557
+.L4	ld4	r7, [r11 + 60]
+.L5	add	r4, r1, r5
+.L6	st4	[sp + 24], r5
+.L7	mv	r10, r6
+	li	r8, $448541FA
+	ret
+.FRAME	.EQU	-96
+FN33	enter	.FRAME
+.L0	li	r7, 0
+	add	r5, r0, r12
+	bz	r9, .L1
+	li	r2, 0
+	ld8	r5, [sp - 88]
+	bne	r5, r6, .L0
+	li	r0, FN51
+	li	r3, 0
+	li	r8, K26
+	ld4	r10, [r13 + 24]
+	ld4	r12, [r11 + 28]
+	li	r3, FN46
+	st4	[sp + 8], r4
+.L1	st4	[sp + 16], r3
+	li	r2, K20
+	st4	[sp + 32], r1
+	st4	[sp + 112], r3
+	bne	r6, r4, .L0
+	and	r1, r10, K13 & $7FFF
+	ld4	r10, [r1 + 208]
+	jal	FN51
+	li	r1, -572
+	shl	r2, 3
+	mv	r6, r12
+	add	r13, r13, 8
+	li	r2, FN50
+	ret
+.FRAME	.EQU	-16
+FN34	enter	.FRAME
+.L0	shl	r7, 2
+	bne	r5, r2, .L5
+	bne	r2, r0, .L2
+	bne	r9, r3, .L3
+	li	r12, K27
+.L1	bz	r0, .L2
+	mv	r4, r4
+	li	r0, 0
+	bz	r5, .L2
+	shl	r5, 1
+.L2	bz	r11, .L1
+	add	r8, r12, r13
+	ld4	r0, [r1 + 96]
+	ld4	r9, [r11 + 140]
+	mv	r10, r3
+.L3	jal	FN21
+	li	r8, K2
+	add	r6, r1, -7
+	jal	FN33
+	li	r13, K11
+.L4	ld8	r9, [sp - 80]
+	li	r8, K28
+	bz	r6, .L0
+	mv	r13, r2
+	st4	[sp + 120], r1
+.L5	ld8	r9, [sp - 96]
+	bne	r0, r1, .L2
+	bne	r2, r2, .L1
+	li	r6, $36C8CCBA
+	li	r8, K10
+	ret
+.FRAME	.EQU	-64
+FN35	enter	.FRAME
+.L0	li	r6, $1E2B1144
+	li	r7, K37
+	li	r1, FN24
+	li	r6, 0
+	shl	r1, 15
+	ld4	r7, [r1 + 244]
+	jal	FN45
+	bz	r0, .L0
+	li	r13, FN12
+	li	r11, 1
+	li	r11, 46
+	bz	r2, .L0
+	ld4	r8, [r9 + 36]
+	li	r3, $51113EF
+	ld4	r7, [r4 + 16]
+	add	r7, r1, 6
+	add	r10, r6, r9
+	bz	r4, .L0
+	and	r11, r8, K36 & $7FFF
+	add	r13, r4, 19
+	ld4	r4, [r9 + 64]
+	li	r4, -121
+	add	r13, r0, -13
+	st4	[sp + 40], r7
+	ret
+.FRAME	.EQU	-128
+FN36	enter	.FRAME
+.L0	li	r1, 0
+	li	r0, K36
+	li	r11, 0
+	and	r9, r2, K27 & $7FFF
+.L1	ld4	r10, [r13 + 120]
+	bz	r10, .L1
+	ld4	r7, [r5 + 64]
+	li	r3, $7A2C68C0
+	li	r6, -140
+.L2	li	r8, 100
+	bz	r10, .L0
+	ld8	r0, [sp - 88]
+	li	r6, K10
+	add	r11, r12, 10
+.L3	ld8	r8, [sp - 8]
+	and	r2, r0, K27 & $7FFF
+	li	r0, K26
+	li	r3, K2
+.L4	bne	r13, r13, .L5
+	li	r7, K32
+	li	r13, -449
+	and	r12, r5, K24 & $7FFF
+	li	r0, K22
+.L5	ld8	r11, [sp - 112]
+	ld8	r7, [sp - 80]
+	li	r13, -184
+	shl	r4, 19
+	jal	FN61
+	ret
+.FRAME	.EQU	-96
+FN37	enter	.FRAME
+.L0	ld4	r3, [r1 + 208]
+	jal	FN9
+	li	r10, 965
+	shl	r8, 31
+.L1	li	r3, K25
+	li	r5, -901
+	li	r1, $6A33B128
+	add	r9, r6, r0
+	li	r12, 1
+.L2	add	r3, r10, r12
+	li	r4, FN73
+	li	r1, -992
+	ld8	r9, [sp - 88]
+	bne	r12, r7, .L1
+	ret
+.FRAME	.EQU	-64
+FN38	enter	.FRAME
+.L0	mv	r0, r10
+	li	r12, K27
+	li	r6, FN13
+	add	r2, r2, -6
+	li	r11, 0
+	st4	[sp + 56], r10
+	add	r11, r6, r7
+.L1	bne	r10, r4, .L0
+	ld8	r9, [sp - 24]
+	shl	r0, 27
+	add	r1, r8, 8
+	and	r1, r1, K7 & $7FFF
+	li	r2, 0
+	st4	[sp + 96], r11
+	ld8	r6, [sp - 80]
+	ret
+.FRAME	.EQU	-128
+FN39	enter	.FRAME
+.L0	add	r0, r10, 4
+	add	r12, r11, 20
+	add	r7, r9, -17
+.L1	li	r11, K27
+	li	r1, $712FEE73
+	st4	[sp + 48], r11
+	ld4	r7, [r7 + 108]
+.L2	li	r2, -845
+	mv	r7, r13
+	ld4	r10, [r7 + 236]
+	li	r0, K21
+.L3	li	r13, 0
+	li	r5, FN81
+	add	r9, r7, 22
+	shl	r2, 22
+.L4	jal	FN42
+	li	r10, 0
+	li	r2, 827
+.L5	jal	FN38
+	bne	r12, r4, .L7
+	li	r1, $6C3BB1A7
+	jal	FN26
+.L6	st4	[sp + 40], r9
+	st4	[sp + 88], r3
+	st4	[sp + 40], r10
+	li	r12, FN65
+.L7	li	r10, FN28
+	li	r1, 542
+	mv	r7, r3
+	li	r12, 0
+	ret
+.FRAME	.EQU	-96
+FN40	enter	.FRAME
+.L0	st4	[sp + 16], r7
+	and	r3, r10, K13 & $7FFF
+	and	r12, r0, K10 & $7FFF
+.L1	bz	r11, .L0
+	add	r10, r1, r3
+	ld4	r11, [r8 + 204]
+.L2	and	r6, r8, K39 & $7FFF
+	mv	r11, r5
+	bne	r1, r13, .L1
+	li	r8, 0
+.L3	li	r13, FN36
+	li	r12, K35
+	add	r6, r5, -13
+.L4	add	r0, r7, r10
+	bz	r1, .L2
+	add	r10, r11, r10
+	add	r10, r9, -15
+.L5	li	r4, FN5
+	li	r2, -295
+	and	r7, r12, K15 & $7FFF
+.L6	li	r0, $207D2998
+	ld4	r9, [r12 + 252]
+	li	r8, -938
+	li	r0, 1
+	ret
+.FRAME	.EQU	-48
+FN41	enter	.FRAME
+.L0	bne	r7, r13, .L2
+	li	r3, K8
+	li	r1, FN46
+	ld8	r0, [sp - 64]
+	li	r8, 0
+.L1	li	r6, FN41
+	bne	r10, r8, .L3
+	li	r8, FN82
+	bne	r7, r8, .L2
+	ld4	r5, [r12 + 8]
+	bne	r4, r4, .L4
+.L2	ld4	r2, [r1 + 120]
+	add	r8, r1, r11
+	bz	r12, .L0
+	li	r3, $62E99B93
+	bz	r10, .L3
+.L3	jal	FN21
+	st4	[sp + 40], r11
+	bne	r9, r8, .L1
+	ld8	r4, [sp - 56]
+	ld8	r10, [sp - 112]
+	li	r1, K31
+.L4	li	r8, FN39
+	bz	r0, .L1
+	bz	r5, .L1
+	bz	r13, .L2
+	add	r3, r2, -18
+	ld4	r4, [r1 + 148]
+	ret
+.FRAME	.EQU	-128
+FN42	enter	.FRAME
+.L0	li	r0, FN15
+	li	r8, 0
+	shl	r4, 20
+.L1	mv	r11, r9
+	bz	r12, .L1
+	li	r12, FN62
+.L2	bne	r13, r3, .L5
+	li	r8, 712
+	add	r11, r0, r7
+.L3	add	r13, r0, 10
+	bz	r3, .L3
+	li	r4, FN63
+.L4	li	r11, -850
+	bne	r5, r2, .L6
+	shl	r8, 6
+.L5	li	r9, $E3AC672
+	jal	FN51
+	add	r12, r2, r2
+.L6	add	r11, r9, r1
+	and	r6, r7, K1 & $7FFF
+	ld4	r13, [r12 + 204]
+.L7	li	r6, 1
+	li	r3, $8EF90A4
+	jal	FN18
+	ret
+.FRAME	.EQU	-48
+FN43	enter	.FRAME
+.L0	li	r3, -745
+	bne	r8, r6, .L2
+	bz	r5, .L2
+	li	r11, 0
+.L1	add	r11, r4, -21
+	mv	r9, r11
+	and	r2, r6, K24 & $7FFF
+	add	r8, r11, r6
+.L2	bz	r6, .L1
+	li	r1, 0
+	and	r11, r5, K0 & $7FFF
+	bne	r10, r4, .L1
+	li	r10, 705
+	ret
+.FRAME	.EQU	-48
+FN44	enter	.FRAME
+.L0	li	r2, $121A69B
+	add	r11, r10, -15
+.L1	add	r4, r13, r10
+	ld4	r0, [r9 + 84]
+.L2	li	r8, K17
+	li	r6, $7DE7897
+.L3	li	r3, K32
+	jal	FN48
+.L4	and	r1, r12, K20 & $7FFF
+	jal	FN48
+	ret
+.FRAME	.EQU	-32
+T4	.BYTE	"eon synthetic workload", 13, 10, 0
+	.ALIGN	4
+FN45	enter	.FRAME
+.L0	ld8	r6, [sp - 56]
+	li	r5, FN20
+	ld4	r10, [r13 + 112]
+	mv	r2, r0
+	ld8	r6, [sp - 8]
+.L1	ld4	r9, [r9 + 104]
+	add	r12, r12, 21
+	jal	FN75
+	add	r3, r12, r12
+	and	r4, r4, K14 & $7FFF
+.L2	mv	r10, r2
+	jal	FN26
+	li	r2, K29
+	li	r10, $2B1A25EC
+	jal	FN62
+	li	r4, 854
+	ret
+.FRAME	.EQU	-128
+FN46	enter	.FRAME
+.L0	li	r12, K26
+	st4	[sp + 88], r0
+	st4	[sp + 112], r13
+	add	r10, r10, -2
+	li	r0, -439
+	li	r11, $6D11425B
+	li	r6, K23
+	li	r1, 0
+.L1	bne	r3, r5, .L1
+	mv	r4, r0
+	add	r7, r12, 5
+	li	r6, FN53
+	and	r0, r11, K4 & $7FFF
+	st4	[sp + 24], r12
+	li	r10, 336
+	and	r10, r8, K14 & $7FFF
+.L2	add	r8, r6, r10
+	jal	FN42
+	li	r3, 0
+	li	r11, 1
+	mv	r0, r0
+	li	r0, $4FB4B1BC
+	add	r4, r12, 16
+	shl	r12, 0
+	ret
+.FRAME	.EQU	-96
+FN47	enter	.FRAME
+.L0	shl	r12, 10
+	ld4	r13, [r5 + 28]
+.L1	bne	r5, r11, .L3
+	add	r7, r5, -9
+.L2	bne	r11, r7, .L1
+	ld8	r10, [sp - 48]
+.L3	jal	FN18
+	add	r0, r5, r4
+.L4	add	r3, r4, -10
+	and	r10, r4, K26 & $7FFF
+	ret
+.FRAME	.EQU	-128
+FN48	enter	.FRAME
+.L0	jal	FN28
+	li	r6, $76B6014
+	li	r1, $746297BA
+	st4	[sp + 72], r2
+	li	r6, $2E5C70C1
+	st4	[sp + 56], r12
+	bne	r0, r4, .L0
+	jal	FN76
+	ld4	r7, [r12 + 252]
+	add	r3, r2, 3
+	st4	[sp + 56], r2
+	li	r11, K8
+	li	r10, FN11
+	li	r2, $10DDBEB4
+.L1	ld4	r12, [r2 + 108]
+	bz	r6, .L0
+	add	r13, r8, -27
+	and	r2, r12, K40 & $7FFF
+	mv	r2, r9
+	jal	FN44
+	li	r7, FN65
+	li	r9, K3
+	shl	r3, 1
+	mv	r11, r7
+	li	r3, $73713F4A
+	ld8	r7, [sp - 72]
+	add	r3, r11, r5
+	li	r1, FN65
+	ret
+.FRAME	.EQU	-16
+FN49	enter	.FRAME
+.L0	shl	r2, 23
+	mv	r5, r2
+	mv	r12, r11
+	shl	r7, 13
+	bz	r2, .L0
+.L1	mv	r13, r8
+	shl	r3, 3
+	ld4	r7, [r0 + 152]
+	shl	r8, 21
+	bz	r3, .L4
+	add	r13, r10, -31
+.L2	st4	[sp + 72], r0
+	li	r13, K4
+	li	r2, $A5DF180
+	jal	FN28
+	li	r1, 1
+	add	r10, r12, r8
+.L3	mv	r2, r0
+	li	r4, 0
+	bne	r7, r5, .L4
+	bne	r0, r3, .L3
+	bz	r13, .L3
+	li	r3, $5FBACCC3
+.L4	li	r6, K7
+	ld8	r5, [sp - 120]
+	and	r4, r12, K31 & $7FFF
+	bne	r13, r4, .L2
+	li	r6, FN28
+	li	r7, FN80
+	ret
+.FRAME	.EQU	-16
+T5	.WORD	1, 2, 4, 8, 16, 32, 64, 128, $100, $200, $400, $800
+FN50	enter	.FRAME
+.L0	li	r7, 1
+	li	r0, 0
+	add	r8, r7, r9
+	ld8	r6, [sp - 112]
+	li	r1, -879
+	bz	r0, .L0
+.L1	bne	r8, r1, .L0
+	bz	r3, .L1
+	and	r0, r1, K23 & $7FFF
+	bz	r12, .L0
+	mv	r4, r3
+	li	r0, K23
+.L2	shl	r11, 21
+	ld8	r6, [sp - 88]
+	li	r2, 1
+	li	r11, K31
+	and	r12, r12, K25 & $7FFF
+	and	r9, r3, K18 & $7FFF
+	jal	FN29
+	ret
+.FRAME	.EQU	-96
+FN51	enter	.FRAME
+.L0	li	r12, -754
+	ld4	r10, [r3 + 248]
+	mv	r6, r5
+	shl	r13, 29
+	li	r9, K17
+	add	r4, r8, -5
+.L1	and	r0, r1, K13 & $7FFF
+	mv	r8, r3
+	ld4	r7, [r0 + 140]
+	mv	r2, r8
+	bne	r11, r1, .L2
+	bne	r5, r12, .L0
+	bne	r9, r11, .L0
+.L2	jal	FN65
+	bz	r6, .L2
+	bne	r4, r7, .L0
+	ld4	r4, [r4 + 52]
+	add	r12, r9, -19
+	bne	r9, r1, .L3
+.L3	li	r5, 809
+	li	r12, K9
+	ld4	r2, [r7 + 12]
+	and	r8, r1, K17 & $7FFF
+	bne	r13, r3, .L1
+	li	r5, $1E3FB33E
+	ld8	r8, [sp - 120]
+	ret
+.FRAME	.EQU	-64
+FN52	enter	.FRAME
+.L0	ld4	r11, [r8 + 196]
+	li	r7, $44CCB98C
+	bz	r0, .L3
+	bz	r1, .L3
+.L1	add	r2, r7, r12
+	ld4	r12, [r13 + 8]
+	and	r10, r4, K24 & $7FFF
+	ld4	r0, [r0 + 236]
+.L2	bne	r1, r7, .L0
+	li	r3, FN47
+	li	r1, -249
+	mv	r3, r10
+.L3	shl	r0, 4
+	add	r10, r5, r11
+	add	r3, r4, -25
+	li	r5, -180
+.L4	and	r6, r2, K0 & $7FFF
+	bne	r0, r2, .L1
+	li	r13, -15
+	mv	r2, r7
+.L5	add	r12, r5, 22
+	li	r10, FN45
+	li	r3, -431
+	li	r4, $322ED4DF
+.L6	shl	r2, 5
+	bne	r10, r1, .L3
+	shl	r7, 24
+	li	r10, K28
+	ret
+.FRAME	.EQU	-32
+FN53	enter	.FRAME
+.L0	bz	r7, .L0
+	and	r11, r1, K3 & $7FFF
+	ld4	r13, [r6 + 112]
+	li	r7, $3B194BBD
+	li	r3, FN54
+	bne	r3, r0, .L2
+	st4	[sp + 16], r12
+	li	r13, 0
+.L1	st4	[sp + 88], r3
+	shl	r8, 3
+	add	r13, r10, r11
+	jal	FN42
+	ld8	r8, [sp - 56]
+	and	r13, r9, K36 & $7FFF
+	li	r11, $72B4F22A
+	add	r11, r12, r6
+.L2	bz	r0, .L0
+	li	r13, K24
+	li	r1, K6
+	li	r2, K14
+	jal	FN32
+	bz	r1, .L1
+	mv	r5, r2
+	bne	r0, r12, .L1
+	ret
+.FRAME	.EQU	-64
+FN54	enter	.FRAME
+.L0	bne	r3, r12, .L2
+	shl	r1, 17
+	shl	r12, 19
+	li	r10, $21945AC3
+	li	r10, -4
+.L1	and	r10, r7, K31 & $7FFF
+	ld4	r10, [r6 + 20]
+	add	r1, r0, r7
+	add	r8, r6, -18
+	ld4	r1, [r7 + 228]
+.L2	li	r5, 514
+	jal	FN3
+	add	r13, r8, 25
+	li	r6, K13
+	mv	r1, r12
+.L3	ld8	r10, [sp - 104]
+	li	r3, FN52
+	ld4	r10, [r5 + 84]
+	mv	r12, r5
+	add	r10, r1, 0
+.L4	shl	r8, 7
+	st4	[sp + 24], r8
+	li	r11, 1
+	bne	r11, r2, .L1
+	li	r1, FN36
+	ret
+.FRAME	.EQU	-96
+FN55	enter	.FRAME
+.L0	add	r10, r12, -23
+	add	r10, r6, r4
+.L1	bne	r10, r7, .L3
+	ld4	r10, [r2 + 224]
+.L2	add	r8, r6, r6
+	mv	r5, r1
+.L3	ld8	r11, [sp - 112]
+	st4	[sp + 64], r12
+.L4	shl	r13, 8
+	li	r10, 313
+	and	r10, r11, K37 & $7FFF
+	ret
+.FRAME	.EQU	-16
+FN56	enter	.FRAME
+.L0	ld4	r12, [r6 + 72]
+	ld8	r2, [sp - 96]
+	jal	FN41
+	add	r3, r6, r3
+	add	r11, r4, -18
+	mv	r11, r12
+.L1	li	r8, 1
+	add	r9, r5, -4
+	ld4	r7, [r1 + 172]
+	shl	r8, 2
+	st4	[sp + 56], r10
+	ld8	r7, [sp - 72]
+.L2	st4	[sp + 120], r0
+	ld8	r10, [sp - 96]
+	st4	[sp + 16], r2
+	bne	r2, r10, .L0
+	li	r2, $39CB3ADF
+	li	r7, FN12
+.L3	li	r1, 0
+	jal	FN30
+	li	r6, K36
+	li	r3, -726
+	bz	r11, .L0
+	add	r0, r9, -11
+	bne	r10, r4, .L1
+	ret
+.FRAME	.EQU	-16
+FN57	enter	.FRAME
+.L0	ld8	r3, [sp - 24]
+	st4	[sp + 96], r10
+	li	r10, $35DA7E04
+	bz	r12, .L1
+.L1	bz	r8, .L5
+	jal	FN71
+	and	r6, r13, K25 & $7FFF
+	add	r10, r5, 26
+.L2	jal	FN82
+	mv	r10, r2
+	bz	r3, .L3
+	li	r9, 175
+.L3	li	r2, $6F15DE9C
+	bne	r12, r7, .L4
+	bz	r4, .L4
+	bne	r1, r12, .L4
+.L4	bz	r13, .L5
+	add	r2, r12, 9
+	bz	r5, .L2
+	bz	r6, .L2
+.L5	bz	r0, .L5
+	li	r11, FN69
+	add	r5, r1, 14
+	jal	FN59
+	ret
+.FRAME	.EQU	-32
+FN58	enter	.FRAME
+.L0	bz	r13, .L1
+	ld8	r4, [sp - 56]
+	ld8	r4, [sp - 80]
+.L1	li	r5, 933
+	add	r6, r13, -15
+	li	r3, FN17
+.L2	li	r6, FN55
+	jal	FN45
+	jal	FN24
+	ret
+.FRAME	.EQU	-128
+FN59	enter	.FRAME
+.L0	and	r13, r2, K18 & $7FFF
+	add	r0, r13, 7
+	add	r3, r1, -8
+	shl	r6, 30
+	bz	r1, .L0
+	li	r11, $248F2D0E
+.L1	jal	FN24
+	and	r13, r6, K9 & $7FFF
+	li	r8, -698
+	st4	[sp + 64], r5
+	li	r13, K27
+	add	r5, r11, 25
+.L2	li	r8, K10
+	li	r12, FN78
+	li	r6, FN38
+	ld8	r8, [sp - 96]
+	and	r13, r9, K13 & $7FFF
+	add	r5, r6, r2
+.L3	and	r13, r10, K4 & $7FFF
+	add	r6, r1, 30
+	ld8	r10, [sp - 112]
+	jal	FN33
+	ld8	r10, [sp - 56]
+	bz	r3, .L3
+	ret
+.FRAME	.EQU	-112
+FN60	enter	.FRAME
+.L0	jal	FN70
+	li	r12, -914
+	li	r12, FN20
+	li	r7, FN20
+	li	r6, 0
+	mv	r2, r11
+	ld4	r7, [r6 + 196]
+	ld8	r2, [sp - 16]
+.L1	and	r2, r8, K14 & $7FFF
+	bne	r11, r4, .L1
+	li	r4, $2EE1A3CC
+	ld4	r11, [r0 + 184]
+	li	r7, 1
+	bz	r8, .L0
+	add	r7, r12, r7
+	jal	FN25
+	bne	r3, r0, .L0
+	ret
+.FRAME	.EQU	-64
+FN61	enter	.FRAME
+.L0	and	r8, r2, K20 & $7FFF
+	li	r10, FN18
+	add	r4, r5, r4
+.L1	li	r9, -982
+	ld4	r10, [r12 + 156]
+	li	r10, -996
+	and	r6, r6, K38 & $7FFF
+.L2	shl	r1, 3
+	ld8	r12, [sp - 112]
+	mv	r3, r2
+	mv	r4, r2
+.L3	and	r6, r9, K25 & $7FFF
+	li	r6, FN47
+	and	r10, r8, K9 & $7FFF
+.L4	li	r2, $66E61373
+	shl	r12, 23
+	add	r3, r0, -11
+	bne	r0, r2, .L1
+.L5	add	r2, r10, -6
+	li	r3, 1
+	add	r4, r1, -19
+	li	r2, -568
+.L6	li	r13, FN1
+	shl	r6, 30
+	ld4	r12, [r4 + 112]
+	li	r6, 959
+	ret
+.FRAME	.EQU	-64
+T6	.BYTE	"eon synthetic workload", 13, 10, 0
+	.ALIGN	4
+FN62	enter	.FRAME
+.L0	ld8	r5, [sp - 8]
+	bne	r0, r12, .L4
+	ld4	r10, [r10 + 244]
+.L1	shl	r9, 16
+	li	r5, 0
+	add	r2, r2, 26
+.L2	li	r9, FN25
+	add	r9, r12, r4
+	bz	r4, .L4
+	li	r0, K22
+.L3	li	r10, $670E4C4A
+	mv	r13, r9
+	li	r12, FN4
+.L4	ld4	r12, [r5 + 96]
+	li	r11, 71
+	li	r1, FN15
+	ld8	r3, [sp - 24]
+.L5	li	r1, 0
+	add	r5, r13, r3
+	li	r7, 0
+.L6	st4	[sp + 88], r1
+	and	r6, r4, K28 & $7FFF
+	bz	r1, .L6
+	and	r5, r0, K17 & $7FFF
+	ret
+.FRAME	.EQU	-96
+FN63	enter	.FRAME
+.L0	add	r13, r5, 22
+	st4	[sp + 32], r13
+	bz	r10, .L4
+	li	r8, 0
+.L1	li	r10, $2909102C
+	bne	r0, r7, .L4
+	and	r1, r13, K21 & $7FFF
+	mv	r7, r10
+	add	r1, r10, -2
+.L2	li	r2, $77D32C14
+	li	r5, K29
+	li	r8, FN19
+	st4	[sp + 88], r6
+	li	r11, -749
+.L3	bne	r1, r13, .L2
+	ld4	r7, [r2 + 52]
+	bz	r7, .L0
+	li	r13, 0
+	li	r3, 644
+.L4	and	r6, r13, K15 & $7FFF
+	li	r11, FN16
+	li	r4, K16
+	jal	FN47
+	add	r5, r5, r12
+	ret
+.FRAME	.EQU	-80
+FN64	enter	.FRAME
+.L0	li	r4, FN13
+	li	r2, 852
+.L1	jal	FN45
+	ld8	r2, [sp - 72]
+.L2	jal	FN31
+	ld4	r3, [r6 + 76]
+.L3	add	r1, r7, -18
+	ld8	r4, [sp - 32]
+.L4	add	r2, r3, 10
+	add	r12, r3, r5
+.L5	st4	[sp + 72], r1
+	mv	r0, r13
+	li	r0, -427
+	ret
+.FRAME	.EQU	-48
+FN65	enter	.FRAME
+.L0	and	r1, r4, K14 & $7FFF
+	and	r5, r10, K23 & $7FFF
+.L1	shl	r12, 21
+	li	r1, -590
+.L2	bne	r8, r11, .L5
+	and	r2, r9, K34 & $7FFF
+	li	r7, FN19
+.L3	add	r1, r5, 24
+	li	r5, $36BE7C23
+.L4	li	r1, FN19
+	bne	r5, r9, .L0
+	bne	r12, r0, .L0
+.L5	li	r8, 153
+	ld8	r2, [sp - 48]
+.L6	li	r5, K0
+	jal	FN41
+	add	r6, r8, -6
+	ret
+.FRAME	.EQU	-64
+FN66	enter	.FRAME
+.L0	li	r10, $6DD72BA4
+	bz	r3, .L5
+	li	r0, 882
+.L1	and	r9, r0, K36 & $7FFF
+	shl	r11, 30
+	bz	r9, .L3
+.L2	st4	[sp + 56], r10
+	bz	r9, .L2
+	bne	r5, r6, .L2
+	li	r12, K13
+.L3	mv	r4, r2
+	li	r5, FN31
+	li	r13, 324
+.L4	ld8	r6, [sp - 80]
+	mv	r3, r3
+	ld4	r9, [r0 + 64]
+.L5	ld8	r6, [sp - 128]
+	shl	r11, 21
+	mv	r11, r8
+	st4	[sp + 72], r8
+	ret
+.FRAME	.EQU	-64
+T7	.LONG	FN12, FN13, FN30, K37
+FN67	enter	.FRAME
+.L0	and	r6, r1, K5 & $7FFF
+	add	r13, r9, -25
+	st4	[sp + 40], r8
+	li	r10, FN72
+	jal	FN0
+	li	r13, FN10
+	add	r12, r4, r11
+.L1	ld4	r6, [r1 + 212]
+	li	r4, $4D5853B6
+	li	r1, K9
+	li	r12, $7696D173
+	li	r13, 0
+	li	r13, K6
+	li	r3, FN81
+	ret
+.FRAME	.EQU	-96
+FN68	enter	.FRAME
+.L0	li	r1, 122
+	li	r6, $736DD4DF
+	li	r0, -331
+	bz	r9, .L0
+	and	r4, r5, K2 & $7FFF
+	st4	[sp + 64], r8
+	li	r7, K33
+	li	r1, 703
+	add	r11, r7, r2
+	ret
+.FRAME	.EQU	-112
+FN69	enter	.FRAME
+.L0	mv	r11, r5
+	li	r7, $3F62E92D
+	ld4	r13, [r3 + 52]
+	li	r11, FN46
+	ld4	r2, [r1 + 48]
+	li	r3, K28
+	li	r2, 0
+.L1	and	r11, r13, K34 & $7FFF
+	li	r8, $ACA1BB5
+	shl	r2, 16
+	add	r9, r0, r11
+	shl	r4, 6
+	li	r8, K31
+	bne	r2, r1, .L2
+.L2	ld4	r2, [r0 + 148]
+	add	r4, r11, r10
+	st4	[sp + 24], r8
+	li	r8, K37
+	jal	FN65
+	add	r13, r1, -15
+	li	r12, 0
+.L3	st4	[sp + 112], r1
+	add	r0, r0, r13
+	li	r12, 544
+	li	r10, $1CE3085D
+	st4	[sp + 120], r4
+	li	r9, 662
+	jal	FN78
+	ret
+.FRAME	.EQU	-112
+T8	.WORD	1, 2, 4, 8, 16, 32, 64, 128, $100, $200, $400, $800
+FN70	enter	.FRAME
+.L0	mv	r2, r7
+	and	r0, r12, K14 & $7FFF
+	ld8	r6, [sp - 16]
+.L1	li	r11, $65B48D8A
+	shl	r12, 26
+	bne	r6, r3, .L2
+.L2	bz	r5, .L6
+	bne	r12, r1, .L7
+	bne	r9, r7, .L5
+.L3	li	r3, FN17
+	li	r12, FN61
+	st4	[sp + 48], r6
+	ld4	r9, [r10 + 180]
+.L4	ld4	r3, [r8 + 184]
+	mv	r1, r4
+	bz	r12, .L6
+.L5	bne	r2, r4, .L0
+	ld8	r9, [sp - 48]
+	ld4	r3, [r7 + 152]
+.L6	li	r4, -797
+	jal	FN9
+	li	r11, 0
+.L7	li	r10, -764
+	li	r2, 1
+	add	r7, r1, 7
+	li	r13, $466A471A
+	ret
+.FRAME	.EQU	-128
+FN71	enter	.FRAME
+.L0	li	r1, $4AA679D0
+	ld8	r13, [sp - 80]
+	li	r1, 0
+	li	r2, FN14
+	st4	[sp + 96], r2
+	bne	r7, r5, .L0
+	st4	[sp + 120], r4
+	li	r9, K14
+	li	r9, 1
+	jal	FN60
+	and	r2, r2, K28 & $7FFF
+	shl	r11, 25
+	li	r10, 1
+	ld8	r6, [sp - 72]
+	li	r12, $6CAD24C
+	add	r3, r3, -11
+	st4	[sp + 24], r4
+	li	r9, $8102BC0
+	li	r5, K19
+	ret
+.FRAME	.EQU	-96
+FN72	enter	.FRAME
+.L0	li	r3, FN33
+	jal	FN44
+.L1	ld8	r11, [sp - 128]
+	shl	r3, 0
+	bz	r11, .L2
+.L2	li	r10, -685
+	st4	[sp + 40], r12
+	li	r8, 624
+	ret
+.FRAME	.EQU	-112
+FN73	enter	.FRAME
+.L0	ld8	r2, [sp - 120]
+	shl	r4, 4
+	jal	FN37
+.L1	jal	FN69
+	ld4	r5, [r3 + 108]
+	shl	r5, 30
+.L2	mv	r1, r13
+	li	r4, $56B6A802
+	li	r1, FN51
+	li	r0, 424
+	ret
+.FRAME	.EQU	-96
+FN74	enter	.FRAME
+.L0	ld4	r5, [r13 + 220]
+	add	r0, r6, 1
+	ld4	r12, [r12 + 68]
+	li	r11, -938
+	bne	r9, r9, .L2
+	mv	r6, r10
+	li	r4, 1
+	mv	r1, r6
+.L1	ld8	r11, [sp - 104]
+	li	r11, 0
+	li	r9, 224
+	ld8	r7, [sp - 88]
+	mv	r13, r8
+	and	r13, r6, K33 & $7FFF
+	bne	r12, r13, .L2
+	ld4	r6, [r4 + 32]
+	ld4	r11, [r1 + 164]
+.L2	and	r12, r3, K21 & $7FFF
+	li	r8, FN77
+	add	r9, r4, 22
+	li	r3, -734
+	jal	FN74
+	bne	r10, r6, .L1
+	jal	FN6
+	and	r6, r6, K2 & $7FFF
+	add	r13, r11, r5
+	ret
+.FRAME	.EQU	-32
+T9	.LONG	FN11, FN21, FN15, K0
+FN75	enter	.FRAME
+.L0	st4	[sp + 80], r2
+.L1	ld4	r10, [r0 + 120]
+.L2	li	r6, FN64
+.L3	st4	[sp + 64], r1
+	bne	r12, r11, .L4
+.L4	ld4	r2, [r9 + 4]
+.L5	bne	r10, r5, .L1
+.L6	bne	r12, r10, .L7
+.L7	bne	r8, r12, .L1
+	add	r2, r7, 3
+	ret
+.FRAME	.EQU	-64
+FN76	enter	.FRAME
+.L0	li	r12, FN2
+	jal	FN47
+	and	r5, r4, K10 & $7FFF
+.L1	bne	r13, r7, .L4
+	li	r10, 0
+	mv	r2, r7
+	ld4	r2, [r3 + 168]
+.L2	bne	r7, r4, .L0
+	li	r8, FN30
+	li	r5, 0
+.L3	ld8	r6, [sp - 88]
+	li	r12, 0
+	bz	r11, .L6
+	li	r8, 0
+.L4	li	r0, 0
+	li	r1, $6DD42719
+	li	r0, FN79
+.L5	li	r2, 0
+	add	r9, r11, 31
+	jal	FN74
+	li	r13, K6
+.L6	add	r10, r13, -22
+	add	r9, r3, r5
+	jal	FN17
+	bne	r3, r12, .L5
+	ret
+.FRAME	.EQU	-48
+FN77	enter	.FRAME
+.L0	add	r5, r6, r11
+	ld8	r6, [sp - 24]
+	bne	r13, r13, .L0
+	mv	r13, r2
+	mv	r2, r13
+	ld8	r3, [sp - 88]
+.L1	st4	[sp + 120], r6
+	mv	r10, r12
+	bz	r2, .L0
+	shl	r3, 26
+	bz	r8, .L3
+	li	r12, -966
+.L2	li	r13, -439
+	ld4	r3, [r12 + 224]
+	li	r9, K16
+	li	r7, 1
+	add	r11, r3, -5
+	ld8	r7, [sp - 80]
+.L3	bne	r8, r13, .L1
+	li	r2, $4562B65B
+	li	r0, K15
+	ld8	r11, [sp - 48]
+	ld4	r0, [r13 + 8]
+	ld8	r6, [sp - 16]
+.L4	li	r10, $292DCFD9
+	shl	r10, 19
+	li	r0, $1755A6E6
+	li	r12, $77F745EC
+	add	r10, r6, r13
+	and	r7, r3, K35 & $7FFF
+	add	r8, r12, -14
+	ret
+.FRAME	.EQU	-48
+FN78	enter	.FRAME
+.L0	mv	r7, r7
+	add	r4, r2, r1
+	ld8	r12, [sp - 104]
+	bz	r4, .L0
+	li	r9, K27
+	jal	FN27
+	bz	r6, .L0
+	add	r6, r1, -4
+.L1	ld8	r4, [sp - 72]
+	and	r12, r11, K25 & $7FFF
+	shl	r8, 0
+	st4	[sp + 32], r4
+	add	r7, r0, r7
+	bne	r4, r11, .L1
+	li	r8, -409
+	ld4	r9, [r12 + 60]
+.L2	li	r12, K0
+	mv	r4, r7
+	li	r9, K18
+	jal	FN56
+	add	r11, r8, -13
+	bne	r12, r7, .L0
+	li	r7, -901
+	add	r0, r5, r11
+	ret
+.FRAME	.EQU	-112
+FN79	enter	.FRAME
+.L0	st4	[sp + 56], r2
+	li	r3, $33FF1A55
+.L1	ld4	r12, [r13 + 96]
+	li	r0, 0
+.L2	jal	FN49
+	ld8	r6, [sp - 104]
+.L3	bz	r5, .L1
+	li	r6, K7
+.L4	ld4	r1, [r4 + 192]
+	st4	[sp + 32], r10
+	ret
+.FRAME	.EQU	-80
+FN80	enter	.FRAME
+.L0	ld4	r7, [r7 + 152]
+	add	r7, r6, r3
+	li	r2, FN64
+	bz	r0, .L5
+.L1	ld8	r4, [sp - 72]
+	ld8	r6, [sp - 16]
+	ld4	r13, [r0 + 88]
+	jal	FN62
+.L2	add	r10, r7, r8
+	add	r7, r3, r0
+	li	r4, K6
+	shl	r0, 19
+.L3	mv	r1, r3
+	shl	r11, 18
+	li	r8, $2B17EF20
+	bz	r9, .L5
+	shl	r2, 4
+.L4	li	r2, 0
+	shl	r0, 8
+	li	r1, $6A6E171C
+	add	r8, r1, 27
+.L5	li	r11, 1
+	li	r13, 1
+	li	r5, FN0
+	bne	r8, r7, .L0
+.L6	ld8	r2, [sp - 112]
+	li	r9, 334
+	mv	r4, r7
+	ld8	r12, [sp - 120]
+	bne	r12, r3, .L2
+	ret
+.FRAME	.EQU	-16
+FN81	enter	.FRAME
+.L0	ld4	r2, [r5 + 68]
+	add	r12, r6, r11
+	and	r2, r5, K14 & $7FFF
+	ld4	r1, [r2 + 184]
+	li	r0, $2920B012
+	bne	r7, r4, .L1
+.L1	bne	r6, r6, .L3
+	st4	[sp + 80], r6
+	st4	[sp + 88], r13
+	ld4	r9, [r4 + 236]
+	st4	[sp + 64], r6
+	add	r5, r1, 26
+.L2	li	r1, K39
+	li	r6, $42A22075
+	st4	[sp + 120], r12
+	shl	r4, 24
+	ld8	r13, [sp - 48]
+	li	r7, K36
+.L3	mv	r0, r6
+	ld8	r3, [sp - 40]
+	li	r5, K21
+	add	r10, r4, r3
+	st4	[sp + 72], r13
+	mv	r11, r8
+	ret
+.FRAME	.EQU	-96
+FN82	enter	.FRAME
+.L0	ld4	r2, [r0 + 92]
+	ld8	r11, [sp - 40]
+	li	r1, K20
+.L1	add	r9, r6, 22
+	bz	r1, .L0
+	ld8	r1, [sp - 88]
+.L2	add	r8, r11, 4
+	bne	r10, r5, .L2
+	li	r11, 0
+.L3	add	r6, r6, 3
+	and	r12, r6, K11 & $7FFF
+	li	r7, FN44
+.L4	bne	r6, r6, .L4
+	jal	FN62
+	li	r12, FN22
+	ld8	r9, [sp - 8]
+	ret
+.FRAME	.EQU	-32
+FN83	enter	.FRAME
+.L0	add	r4, r12, r4
+	li	r10, $1EE99347
+	li	r0, FN26
+	st4	[sp + 32], r6
+	bne	r1, r8, .L1
+	jal	FN5
+	and	r2, r8, K23 & $7FFF
+	add	r2, r8, r7
+.L1	bne	r5, r11, .L1
+	add	r2, r2, r2
+	li	r9, 214
+	st4	[sp + 112], r6
+	shl	r8, 13
+	li	r8, FN66
+	li	r2, K18
+	bne	r4, r1, .L2
+.L2	and	r2, r7, K38 & $7FFF
+	ld4	r7, [r11 + 12]
+	add	r10, r0, r6
+	bne	r3, r13, .L2
+	st4	[sp + 120], r0
+	mv	r4, r7
+	and	r13, r0, K35 & $7FFF
+	add	r2, r12, r6
+	ret
+.FRAME	.EQU	-80
+	.END
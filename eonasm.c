@@ -5,14 +5,21 @@
  * (c) JCGV, junio del 2022
  *
  */
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <stdarg.h>
 #include <errno.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 
 /*
  * config
@@ -21,9 +28,17 @@
 
 #define MAX_LINE	    128     // max chars per lines
 #define MAX_ERRORS	    8	    // error count abort
-#define MAX_LABELS	    512     // label table size
+#define MAX_LABELS	    512     // initial label table size, grows on demand
 #define MAX_CHAR_LABEL	    22	    // significative label chars
 #define OUTPUT_LINE_BYTES   32	    // bytes per line in intel hex output
+#define MAX_WARNINGS	    64	    // warnings kept for the json report
+#define MAX_PASSES	    32	    // passes kept for the json report
+#define MAX_SECTIONS	    8	    // .SECTION address streams
+#define MAX_PARAMS	    8	    // .MACRO parameters
+#define MAX_MACRO_DEPTH     16	    // nested macro expansions
+#define MAX_IF_DEPTH	    16	    // nested .IF
+#define MAX_INCLUDE_DEPTH   16	    // nested .INCLUDE
+#define MAX_REGIONS	    64	    // image regions kept for the json report
 
 /*
  * ctype support
@@ -31,6 +46,7 @@
 static int isdigit (int c) {return (unsigned) c - '0'  < 10;}
 static int isalpha (int c) {return ((unsigned) c | 32) - 'a' < 26;}
 static int isalnum (int c) {return isalpha (c) || isdigit (c);}
+static int isxdigit (int c) {return isdigit (c) || ((unsigned) c | 32) - 'a' < 6;}
 
 static int islower (int c) {return (unsigned) c - 'a'  < 26;}
 static int toupper (int c) {return islower (c) ? c & 0x5f : c;}
@@ -62,17 +78,28 @@ static const char * fmt (const char *s, ...) {
 			*p++ = hdigit[(n >>  4) & 0x0f];
 			*p++ = hdigit[(n >>  0) & 0x0f];
 		    } break;
-		case '5': { // unsigned formatted to 5 digits
+		case '5': { // unsigned formatted to at least 5 digits
 			unsigned  n = va_arg (va, unsigned);
-			char out[6] = {' ', ' ', ' ', ' ', '0', 0};
-			char	*d  = &out[5];
+			char out[10] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', '0'};
+			char	*d   = &out[10];
 			while (n > 0) {
 			    *--d = n % 10 + '0';
 			    n	/= 10;
 			}
-			for (int i = 0; i < 5; i++)
+			for (int i = d < &out[5] ? d - out : 5; i < 10; i++)
 			    *p++ = out[i];
 		    } break;
+		case 'U': { // unsigned long long, no padding
+			unsigned long long n = va_arg (va, unsigned long long);
+			char  out[24];
+			char *d = &out[sizeof (out)];
+			do {
+			    *--d = n % 10 + '0';
+			    n	/= 10;
+			} while (n > 0);
+			while (d < &out[sizeof (out)])
+			    *p++ = *d++;
+		    } break;
 		case 's': { // string null terminated
 			const char *z = va_arg (va, const char *);
 			while (*z)
@@ -95,6 +122,71 @@ static const char * fmt (const char *s, ...) {
     return fmtline;
 }
 
+/*
+ * stats engine
+ */
+enum {PH_IDLE, PH_READ, PH_LEX, PH_EXPR, PH_MATCH, PH_ENCODE, PH_EMIT, PH_LIST, PH_MAX};
+
+static const char *phname[PH_MAX] = {
+    "idle", "read", "lex", "expr", "match", "encode", "emit", "listing"
+};
+
+static struct {
+    bool	on;	    // --stats given
+    unsigned	cur;	    // current phase
+    uint64_t	mark;	    // timestamp of last phase switch
+    uint64_t	ns[PH_MAX]; // wall time per phase
+    uint64_t	lines;	    // source lines processed
+    uint64_t	bytes;	    // source bytes processed
+} stats;
+
+/*
+ * hot path counters, compiled only with -DCOUNTERS (make counters)
+ */
+#ifdef COUNTERS
+#define COUNT(c,n)  (counters.c += (n))
+
+static struct {
+    uint64_t	labels;     // find_label calls
+    uint64_t	probes;     // find_label table probes
+    uint64_t	names;	    // find_label name compares
+    uint64_t	exprs;	    // expr calls
+    uint64_t	items;	    // expr items (values and operators)
+    uint64_t	matches;    // match calls
+    uint64_t	compares;   // match template comparisons
+    uint64_t	readlines;  // source lines served
+    uint64_t	reads;	    // read syscalls
+    uint64_t	prints;     // _print calls
+    uint64_t	writes;     // write syscalls
+    uint64_t	written;    // bytes written
+    uint64_t	literals;   // data literals scanned without expr
+} counters;
+
+static const char *counter_name[] = {
+    "find_label calls", "find_label probes", "find_label name compares",
+    "expr calls", "expr items", "match calls", "match compares",
+    "source lines", "read syscalls", "_print calls", "write syscalls", "bytes written",
+    "data literals"
+};
+#else
+#define COUNT(c,n)  ((void) 0)
+#endif
+
+static uint64_t clock_ns (clockid_t id) {
+    struct timespec ts;
+    clock_gettime (id, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void phase (unsigned ph) {
+    if (stats.on) {
+	uint64_t t = clock_ns (CLOCK_MONOTONIC);
+	stats.ns[stats.cur] += t - stats.mark;
+	stats.mark	     = t;
+    }
+    stats.cur = ph;
+}
+
 /*
  * output engine
  */
@@ -102,10 +194,13 @@ static int ofd;
 
 static void _print (int fd, int l, const char *s) {
     if (l < 0) l = strlen (s);
+    COUNT (prints, 1);
+    COUNT (written, l);
 
     int done = 0;
     while (done < l) {
 	int rc = write (fd, s + done, l - done);
+	COUNT (writes, 1);
 	if (rc <= 0) {
 	    static const char ioerr[] = "eonasm: I/O error in print\n";
 	    write (STDERR_FILENO, ioerr, sizeof (ioerr) - 1);
@@ -120,6 +215,7 @@ static void _print (int fd, int l, const char *s) {
 #define iprint(l,s) _print (ofd, l, s)
 
 static void output_to (const char *path) {
+    if (ofd > STDERR_FILENO) close (ofd);
     ofd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
     if (ofd < 0) {
 	eprint (-1, fmt ("eonasm: can not create output file [%s]: %m\n", path));
@@ -127,42 +223,111 @@ static void output_to (const char *path) {
     }
 }
 
+/*
+ * trace engine, chrome trace event format (single thread, tid 1)
+ */
+static int	tfd = -1;
+static char	tbuf[4096];
+static unsigned tlen;
+static unsigned tcount;     // events written
+static uint64_t t0;	    // trace time origin
+
+static void trace_flush (void) {
+    if (tlen) _print (tfd, tlen, tbuf);
+    tlen = 0;
+}
+
+static void trace_put (const char *s) {
+    unsigned l = strlen (s);
+    if (tlen + l > sizeof (tbuf))
+	trace_flush ();
+    if (l > sizeof (tbuf))
+	_print (tfd, l, s);
+    else {
+	memcpy (tbuf + tlen, s, l);
+	tlen += l;
+    }
+}
+
+static void trace_string (const char *z) {
+    char buf[2] = {0, 0};
+    trace_put ("\"");
+    for (; *z; z++) {
+	if (*z == '"' || *z == '\\') trace_put ("\\");
+	buf[0] = *z < ' ' ? ' ' : *z;
+	trace_put (buf);
+    }
+    trace_put ("\"");
+}
+
+static void trace_us (uint64_t ns) {
+    char buf[8] = {'.', 0, 0, 0, 0};
+    trace_put (fmt ("%U", (unsigned long long) ns / 1000));
+    for (int i = 3; i > 0; i--, ns /= 10)
+	buf[i] = ns % 10 + '0';
+    trace_put (buf);
+}
+
+// complete event, args is a json object body or NULL
+static void trace_event (const char *name, const char *cat, uint64_t ts, uint64_t dur, const char *args) {
+    trace_put (tcount++ ? ",\n{\"name\": " : "\n{\"name\": ");
+    trace_string (name);
+    trace_put (fmt (", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": ", cat));
+    trace_us (ts - t0);
+    trace_put (", \"dur\": ");
+    trace_us (dur);
+    if (args) {
+	trace_put (", \"args\": {");
+	trace_put (args);
+	trace_put ("}");
+    }
+    trace_put ("}");
+}
+
+static void trace_close (void) {
+    trace_put ("\n], \"displayTimeUnit\": \"ms\"}\n");
+    trace_flush ();
+    close (tfd);
+}
+
+static void trace_to (const char *path) {
+    tfd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (tfd < 0) {
+	eprint (-1, fmt ("eonasm: can not create trace file [%s]: %m\n", path));
+	exit   (1);
+    }
+    trace_put ("{\"traceEvents\": [");
+    trace_put ("\n{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"eonasm\"}},");
+    trace_put ("\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"assembler\"}}");
+    tcount = 1;
+    atexit (trace_close);
+}
+
 /*
  * globals
  */
 static unsigned errcount;
 const char * source;
+static unsigned srcidx;
+
+typedef struct {const char *source; unsigned lineno; const char *msg; const char *sym; unsigned symlen;} diag_t;
+
+static diag_t	vdiag[MAX_ERRORS];
+static diag_t	vwarn[MAX_WARNINGS];
+static unsigned nwarn;
+
+static void warning (const char *src, unsigned lineno, const char *msg, const char *sym, unsigned symlen) {
+    if (nwarn < MAX_WARNINGS)
+	vwarn[nwarn++] = (diag_t) {src, lineno, msg, sym, symlen};
+}
 
 static void error (unsigned lineno, const char *msg) {
     eprint (-1, fmt ("eonasm error at line %5 of %s: %s\n", lineno, source, msg));
+    vdiag[errcount] = (diag_t) {source, lineno, msg, NULL, 0};
     errcount++;
     if (errcount >= MAX_ERRORS) exit (1);
 }
 
-/*
- * input engine
- */
-static bool readline (int fd, uint8_t *buf, unsigned bytes, int lineno) {
-    uint8_t *b = buf;
-    uint8_t *e = b + bytes;
-    while (b < e) {
-	int l = read (fd, b, 1);
-	if (l < 0) {
-	    eprint (-1, fmt ("eonasm: error reading [%s]: %m\n", source));
-	    exit   (1);
-	}
-	b += l;
-	if (l == 0 || b[-1] == '\n')
-	    break;
-    }
-    if (b >= e) {
-	eprint (-1, fmt ("eonasm: line %5 of [%s] is too long\n", lineno, source));
-	exit   (1);
-    }
-    *b++ = 0;
-    return b != buf + 1;
-}
-
 /*
  * output image
  */
@@ -170,9 +335,19 @@ static uint8_t	line[OUTPUT_LINE_BYTES];
 static unsigned pending;
 static unsigned basepc;
 static unsigned outpc;
+static unsigned outhi;	    // upper 16 address bits of the last extended linear address record
+
+static struct {unsigned at, size;} vregion[MAX_REGIONS];
+static unsigned nregion;    // regions seen, first MAX_REGIONS kept
+static unsigned imagesize;
 
 static void emit_flush (void) {
     if (pending) {
+	uint64_t t = tfd >= 0 ? clock_ns (CLOCK_MONOTONIC) : 0;
+	if ((basepc >> 16) != outhi) {
+	    outhi = basepc >> 16;
+	    iprint (-1, fmt (":02000004%w%b\n", outhi, (0 - (6 + (outhi >> 8) + outhi)) & 0x0ff));
+	}
 	iprint (-1, fmt (":%b%w00", pending, basepc));
 	uint8_t crc = pending + (basepc >> 8) + basepc;
 	for (unsigned i = 0; i < pending; i++) {
@@ -181,17 +356,26 @@ static void emit_flush (void) {
 	    iprint (-1, fmt ("%b", byte));
 	}
 	iprint (-1, fmt ("%b\n", (0 - crc) & 0x0ff));
+	if (tfd >= 0) {
+	    static char args[64];
+	    memcpy (args, fmt ("\"addr\": %U, \"bytes\": %U", (unsigned long long) basepc, (unsigned long long) pending), sizeof (args));
+	    trace_event ("flush", "io", t, clock_ns (CLOCK_MONOTONIC) - t, args);
+	}
 	pending = 0;
     }
 }
 
-static void emit (uint16_t at, uint8_t byte) {
-    if (pending >= OUTPUT_LINE_BYTES || at != outpc) {
+static void emit (uint32_t at, uint8_t byte) {
+    if ((at != outpc || !imagesize) && ++nregion <= MAX_REGIONS)
+	vregion[nregion - 1].at = at;
+    if (pending >= OUTPUT_LINE_BYTES || at != outpc || !(at & 0xffff)) {
 	emit_flush ();
 	outpc = basepc = at;
     }
     line[pending++] = byte;
     outpc++;
+    imagesize++;
+    if (nregion <= MAX_REGIONS) vregion[nregion - 1].size++;
 }
 
 static void emit_done (void) {
@@ -199,85 +383,442 @@ static void emit_done (void) {
     iprint     (-1, ":00000001FF\n");
 }
 
+/*
+ * memory accounting
+ */
+enum {MEM_SYMBOLS, MEM_NAMES, MEM_IR, MEM_OUTPUT, MEM_MAX};
+
+static const char *memname[MEM_MAX] = {
+    "symbols", "names", "ir", "output"
+};
+
+static struct {
+    uint64_t	cur[MEM_MAX];	// bytes allocated per subsystem
+    uint64_t	peak[MEM_MAX];	// high-water mark per subsystem
+    uint64_t	total;		// bytes allocated
+    uint64_t	top;		// high-water mark of total
+    uint64_t	pass_top;	// high-water mark of total in current pass
+} mem;
+
+static void * xrealloc (unsigned sub, void *p, size_t old, size_t size) {
+    void *n = realloc (p, size);
+    if (!n && size) {
+	eprint (-1, fmt ("eonasm: out of memory (%U bytes for %s)\n", (unsigned long long) size, memname[sub]));
+	exit   (1);
+    }
+    mem.cur[sub] += size - old;
+    mem.total	 += size - old;
+    if (mem.cur[sub] > mem.peak[sub]) mem.peak[sub] = mem.cur[sub];
+    if (mem.total > mem.top)	      mem.top	    = mem.total;
+    if (mem.total > mem.pass_top)     mem.pass_top  = mem.total;
+    return n;
+}
+
+/*
+ * input engine: every source is read once per run and split in lines, passes and
+ * .INCLUDE serve lines from memory
+ */
+typedef struct {
+    char       *name;
+    uint8_t    *text;
+    uint32_t	size;
+    uint32_t   *vline;	    // line offsets, nline + 1 entries
+    uint32_t	nline;
+    char	guard[MAX_CHAR_LABEL + 1];  // .IFNDEF wrapping the whole file, "" for none
+} src_t;
+
+static struct {
+    src_t      *v;
+    unsigned	n;
+    unsigned	max;
+    uint64_t	bytes;	    // read from disk
+} srcs;
+
+static struct {
+    unsigned	depth;
+    struct {unsigned src, line;} vframe[MAX_INCLUDE_DEPTH + 1];
+    uint64_t	count;	    // .INCLUDE entered on the last pass
+    uint64_t	guarded;    // skipped by their guard on the last pass
+} inc;
+
+static bool is_directive (const uint8_t *p, const char *name) {
+    if (*p++ != '.') return false;
+    for (; *name; name++, p++)
+	if (toupper (*p) != *name) return false;
+    return !isalnum (*p);
+}
+
+// a file wrapped in .IFNDEF NAME / .ENDIF is only entered while NAME is undefined
+static void src_guard (src_t *f) {
+    unsigned depth = 0;
+    bool     done  = false;
+    for (unsigned i = 0; i < f->nline; i++) {
+	const uint8_t *p   = f->text + f->vline[i];
+	const uint8_t *e   = f->text + f->vline[i + 1];
+	bool	       dir = *p <= ' ';
+	while (p < e && *p <= ' ') p++;
+	if (p == e || *p == ';' || *p == '#')
+	    continue;
+
+	// anything outside the block, or an .ELSE of the guard
+	if (done || (!depth && (!dir || !is_directive (p, "IFNDEF"))) || (depth == 1 && dir && is_directive (p, "ELSE"))) {
+	    f->guard[0] = 0;
+	    return;
+	}
+	if (!depth) {
+	    unsigned n = 0;
+	    for (p += 7; p < e && *p <= ' '; p++);
+	    for (; p < e && (isalnum (*p) || *p == '_') && n < MAX_CHAR_LABEL; p++)
+		f->guard[n++] = toupper (*p);
+	    f->guard[n] = 0;
+	    depth	= 1;
+	} else if (dir && is_directive (p, "ENDIF"))
+	    done = !--depth;
+	else if (dir && (is_directive (p, "IF") || is_directive (p, "IFDEF") || is_directive (p, "IFNDEF")))
+	    depth++;
+    }
+    if (!done)
+	f->guard[0] = 0;
+}
+
+static unsigned src_load (const char *name) {
+    for (unsigned i = 0; i < srcs.n; i++)
+	if (!strcmp (srcs.v[i].name, name))
+	    return i;
+
+    // read
+    int fd = open (name, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat (fd, &st) < 0) {
+	eprint (-1, fmt ("error opening [%s]: %m\n", name));
+	exit   (1);
+    }
+    uint8_t *text = xrealloc (MEM_IR, NULL, 0, st.st_size + 1);
+    size_t   len  = 0;
+    while (len < (size_t) st.st_size) {
+	ssize_t l = read (fd, text + len, st.st_size - len);
+	COUNT (reads, 1);
+	if (l < 0) {
+	    eprint (-1, fmt ("eonasm: error reading [%s]: %m\n", name));
+	    exit   (1);
+	}
+	if (!l) break;
+	len += l;
+    }
+    close (fd);
+    text[len]	= 0;	// a scan of the last line stops here
+    srcs.bytes += len;
+
+    // split, lines keep their '\n'
+    if (srcs.n == srcs.max) {
+	unsigned n = srcs.max ? srcs.max * 2 : 16;
+	srcs.v	   = xrealloc (MEM_IR, srcs.v, srcs.max * sizeof (src_t), n * sizeof (src_t));
+	srcs.max   = n;
+    }
+    src_t *f = &srcs.v[srcs.n];
+    memset (f, 0, sizeof (*f));
+    f->name  = strcpy (xrealloc (MEM_NAMES, NULL, 0, strlen (name) + 1), name);
+    f->text  = text;
+    f->size  = len;
+    unsigned max = 1;
+    for (size_t i = 0; i < len; i++)
+	max += text[i] == '\n';
+    f->vline = xrealloc (MEM_IR, NULL, 0, (max + 1) * sizeof (uint32_t));
+    for (size_t i = 0; i < len;) {
+	size_t e = i;
+	while (e < len && text[e++] != '\n');
+	if (e - i >= MAX_LINE) {
+	    eprint (-1, fmt ("eonasm: line %5 of [%s] is too long\n", f->nline + 1, name));
+	    exit   (1);
+	}
+	f->vline[f->nline++] = i;
+	i = e;
+    }
+    f->vline[f->nline] = len;
+    f->vline = xrealloc (MEM_IR, f->vline, (max + 1) * sizeof (uint32_t), (f->nline + 1) * sizeof (uint32_t));
+    src_guard (f);
+    return srcs.n++;
+}
+
+// relative to the including file first, then as given
+static unsigned src_include (const char *name) {
+    static char path[PATH_MAX];
+    const char *dir = strrchr (source, '/');
+    size_t	len = dir ? dir - source + 1 : 0;
+    if (*name != '/' && len && len + strlen (name) < sizeof (path)) {
+	memcpy (path, source, len);
+	strcpy (path + len, name);
+	if (!access (path, R_OK))
+	    return src_load (path);
+    }
+    return src_load (name);
+}
+
+static void src_reset (void) {
+    for (unsigned i = 0; i < srcs.n; i++) {
+	xrealloc (MEM_NAMES, srcs.v[i].name, strlen (srcs.v[i].name) + 1, 0);
+	xrealloc (MEM_IR, srcs.v[i].text, srcs.v[i].size + 1, 0);
+	xrealloc (MEM_IR, srcs.v[i].vline, (srcs.v[i].nline + 1) * sizeof (uint32_t), 0);
+    }
+    srcs.n     = 0;
+    srcs.bytes = 0;
+    inc.count  = inc.guarded = 0;
+}
+
+// next line of the innermost file
+static bool src_line (uint8_t *buf, uint32_t *plineno) {
+    while (inc.depth) {
+	src_t	*f = &srcs.v[inc.vframe[inc.depth - 1].src];
+	unsigned n = inc.vframe[inc.depth - 1].line;
+	if (n < f->nline) {
+	    unsigned len = f->vline[n + 1] - f->vline[n];
+	    memcpy (buf, f->text + f->vline[n], len);
+	    buf[len] = 0;
+	    COUNT (readlines, 1);
+	    stats.bytes += len;
+	    inc.vframe[inc.depth - 1].line = *plineno = n + 1;
+	    srcidx = inc.vframe[inc.depth - 1].src;
+	    source = f->name;
+	    return true;
+	}
+	if (inc.depth == 1)
+	    return false;
+	inc.depth--;
+    }
+    return false;
+}
+
 /*
  * labels
  */
 typedef struct label_t * label_t;
 struct label_t {
     uint32_t	value;	    // value
-    uint16_t	lbegin;     // local stack index
-    uint16_t	lend;	    // local labels
+    uint32_t	lineno;     // definition line
+    uint32_t	lbegin;     // first local label index
+    uint32_t	lend;	    // local labels end
+    uint16_t	file;	    // definition source index
+    uint16_t	seen;	    // pass + 1 that last assembled the definition, UINT16_MAX for -D
     uint8_t	flags;
     uint8_t	len;
     char	name[MAX_CHAR_LABEL];
+    uint32_t	thread;     // -T: target of the bra/jmp at the label, see label_ref
+    uint32_t	equ;	    // .EQU record + 1, 0 for none
+    uint32_t	deps;	    // first statement referencing it (reeval edge + 1), 0 for none
 };
 
 #define LABEL_USED  0x01
 #define LABEL_EQU   0x02
-
-static unsigned       nlabel;
-static unsigned       lstack = MAX_LABELS;
-static struct label_t tlabel[MAX_LABELS];
+#define LABEL_CONST 0x04    // equate of a constant expr, same value on every pass
+#define LABEL_LOOP  0x08    // backward branch target, sticky
+#define LABEL_RET   0x10    // -T: a ret at the label
+#define LABEL_BRA   0x20    // -T: a bra/jmp to another label at the label
+#define LABEL_LAZY  0x40    // .EQU with undefined references, evaluated on first use
+#define LABEL_BUSY  0x80    // .EQU being evaluated, cycle detection
+
+static unsigned nlabel;     // global labels
+static unsigned nlocal;     // local labels
+static unsigned maxlabel;
+static unsigned maxlocal;
+static label_t	tlabel;     // global labels, pointers stay valid while locals are added
+static label_t	tlocal;     // local labels, contiguous per main label
+
+#define LABEL_LOCAL_REF 0x80000000u // label_ref of a local label
 
 static label_t find_label (label_t master, const char *id, unsigned len) {
     if (len > MAX_CHAR_LABEL) len = MAX_CHAR_LABEL;
 
     // search
+    COUNT (labels, 1);
+    label_t  t	 = tlabel;
     unsigned i	 = 0;
     unsigned end = nlabel;
     if (master) {
-	i = master->lbegin;
+	t   = tlocal;
+	i   = master->lbegin;
 	end = master->lend;
     }
 
     for (; i < end; ++i) {
-	label_t l = &tlabel[i];
-	if (len == l->len && !memcmp (id, l->name, len))
+	label_t l = &t[i];
+	COUNT (probes, 1);
+	if (len == l->len && (COUNT (names, 1), !memcmp (id, l->name, len)))
 	    return l;
     }
     return NULL;
 }
 
-static label_t add_label (label_t master, const char *id, unsigned len, unsigned at) {
+static label_t add_label (label_t master, const char *id, unsigned len, unsigned at, unsigned lineno) {
     // check for space
-    if (nlabel >= lstack) {
-	eprint (-1, fmt ("eonasm: too many labels (> %5) %5 global %5 local\n", MAX_LABELS, nlabel, MAX_LABELS - lstack));
-	exit   (1);
+    if (master && nlocal >= maxlocal) {
+	unsigned n = maxlocal ? maxlocal * 2 : MAX_LABELS;
+	tlocal	   = xrealloc (MEM_SYMBOLS, tlocal, maxlocal * sizeof (*tlocal), n * sizeof (*tlocal));
+	maxlocal   = n;
+    } else if (!master && nlabel >= maxlabel) {
+	unsigned n = maxlabel ? maxlabel * 2 : MAX_LABELS;
+	tlabel	   = xrealloc (MEM_SYMBOLS, tlabel, maxlabel * sizeof (*tlabel), n * sizeof (*tlabel));
+	maxlabel   = n;
     }
 
     // register label
     label_t l = NULL;
     if (master) {
-	l = &tlabel[--lstack];
-	master->lbegin = lstack;
+	if (master->lbegin == master->lend)
+	    master->lbegin = nlocal;
+	l = &tlocal[nlocal++];
+	master->lend = nlocal;
     } else {
 	l = &tlabel[nlabel++];
-	l->lbegin = l->lend = lstack;
+	l->lbegin = l->lend = nlocal;
     }
 
     // init
-    l->value = at;
-    l->len   = len > MAX_CHAR_LABEL ? MAX_CHAR_LABEL : len;
+    l->value  = at;
+    l->lineno = lineno;
+    l->file   = srcidx;
+    l->flags  = 0;
+    l->equ    = 0;
+    l->seen   = 0;
+    l->deps   = 0;
+    l->len    = len > MAX_CHAR_LABEL ? MAX_CHAR_LABEL : len;
 
     // setup name
-    memcpy (l->name, id, len);
+    memset (l->name, 0, MAX_CHAR_LABEL);
+    memcpy (l->name, id, l->len);
 
     // done
     //eprint (-1, fmt ("label %s %5 [%s] = %w\n", master ? "local" : "global", l->len, l->name, l->value));
     return l;
 }
 
+// label index kept across table growth, locals tagged with LABEL_LOCAL_REF
+static uint32_t label_ref (label_t l) {
+    return l >= tlabel && l < tlabel + nlabel ? (uint32_t) (l - tlabel) : (uint32_t) (l - tlocal) | LABEL_LOCAL_REF;
+}
+
+static label_t label_at (uint32_t ref) {
+    return ref & LABEL_LOCAL_REF ? &tlocal[ref & ~LABEL_LOCAL_REF] : &tlabel[ref];
+}
+
+/*
+ * statement state, kept across passes (statements are numbered in source order)
+ */
+#define STMT_LONG   0x01    // branch or jmp needs the long form
+#define STMT_TAIL   0x02    // jal followed by ret, emitted as jmp
+#define STMT_GONE   0x04    // ret after a fused jal, dropped
+#define STMT_DEPS   0x08    // referenced labels recorded
+#define STMT_DIRTY  0x10    // a referenced label moved since the encoding was cached
+#define STMT_CACHED 0x20    // encoding cached
+
+static uint8_t *vstmt;
+static unsigned maxstmt;
+static unsigned stmt;	    // current statement
+
+static uint8_t * stmt_state (unsigned i) {
+    if (i >= maxstmt) {
+	unsigned n = maxstmt ? maxstmt * 2 : 1024;
+	while (n <= i) n *= 2;
+	vstmt = xrealloc (MEM_IR, vstmt, maxstmt, n);
+	memset (vstmt + maxstmt, 0, n - maxstmt);
+	maxstmt = n;
+    }
+    return &vstmt[i];
+}
+
+/*
+ * minimal re-evaluation: labels know the instruction statements whose expressions
+ * reference them; a moving label marks them dirty, clean statements at the same pc (or
+ * not pc relative) reuse the encoding of the previous pass instead of being parsed again
+ */
+typedef struct {
+    uint32_t	st;
+    uint32_t	next;	    // edge + 1, 0 ends the list
+} dep_t;
+
+typedef struct {
+    uint32_t	pc;
+    uint32_t	hash;	    // line text
+    uint8_t	bytes;
+    uint8_t	relative;   // encoding depends on the pc
+    uint8_t	code[10];
+} cache_t;
+
+static struct {
+    bool	on;
+    bool	rec;	    // expr records references for statement st
+    unsigned	st;
+    dep_t      *vdep;
+    unsigned	ndep;
+    unsigned	maxdep;
+    cache_t    *vcache;
+    unsigned	maxcache;
+    uint64_t	evaluated;  // instructions parsed and encoded
+    uint64_t	reused;     // instructions taken from the cache
+} reeval = {.on = true};
+
+static void reeval_dep (label_t l) {
+    for (unsigned e = l->deps; e; e = reeval.vdep[e - 1].next)
+	if (reeval.vdep[e - 1].st == reeval.st)
+	    return;
+    if (reeval.ndep == reeval.maxdep) {
+	unsigned n    = reeval.maxdep ? reeval.maxdep * 2 : 1024;
+	reeval.vdep   = xrealloc (MEM_IR, reeval.vdep, reeval.maxdep * sizeof (dep_t), n * sizeof (dep_t));
+	reeval.maxdep = n;
+    }
+    reeval.vdep[reeval.ndep] = (dep_t) {reeval.st, l->deps};
+    l->deps = ++reeval.ndep;
+}
+
+static void label_moved (label_t l) {
+    for (unsigned e = l->deps; e; e = reeval.vdep[e - 1].next)
+	vstmt[reeval.vdep[e - 1].st] |= STMT_DIRTY;
+}
+
+static cache_t * reeval_cache (unsigned st) {
+    if (st >= reeval.maxcache) {
+	unsigned n	= reeval.maxcache ? reeval.maxcache * 2 : 1024;
+	while (n <= st) n *= 2;
+	reeval.vcache	= xrealloc (MEM_IR, reeval.vcache, reeval.maxcache * sizeof (cache_t), n * sizeof (cache_t));
+	reeval.maxcache = n;
+    }
+    return &reeval.vcache[st];
+}
+
+static uint32_t line_hash (const uint8_t *p) {
+    uint32_t h = 2166136261u;
+    while (*p)
+	h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+static void reeval_reset (void) {
+    reeval.on	     = true;
+    reeval.rec	     = false;
+    reeval.ndep      = 0;
+    reeval.evaluated = reeval.reused = 0;
+}
+
 /*
  * expr parser
  */
 typedef struct {uint8_t *p; unsigned v;} vp_t;
 
+static unsigned exprlabels; // label references seen by expr
+static unsigned exprpc;     // $$ references seen by expr
+static label_t	exprlast;   // last label resolved by expr
+static unsigned exprundef;  // undefined label references seen by expr
+
+static bool equ_eval (label_t l, bool final);
+
 static vp_t expr (unsigned lineno, label_t mainlbl, bool allow_undef, unsigned pc, uint8_t *p) {
     uint32_t sval[8];
     uint32_t sop[8];
     uint32_t vsp = 0;
     uint32_t osp = 0;
     uint32_t max = 8;
+    unsigned ph  = stats.cur;
+    phase (PH_EXPR);
+    COUNT (exprs, 1);
     for (;;) {
 	// skip spaces
 	while (*p && *p <= ' ')
@@ -298,6 +839,7 @@ static vp_t expr (unsigned lineno, label_t mainlbl, bool allow_undef, unsigned p
 	    if (*p == '$') {
 		v = pc;
 		p++;
+		exprpc++;
 	    } else {
 		// hex number
 		for (;; p++) {
@@ -333,7 +875,12 @@ static vp_t expr (unsigned lineno, label_t mainlbl, bool allow_undef, unsigned p
 		*n++ = toupper (*p);
 
 	    label_t lbl = find_label (local ? mainlbl : NULL, name, n - name);
+	    if (lbl && (lbl->flags & LABEL_LAZY) && !equ_eval (lbl, !allow_undef))
+		lbl = NULL;
+	    if (!lbl || !(lbl->flags & LABEL_CONST))
+		exprlabels++;
 	    if (!lbl) {
+		exprundef++;
 		if (!allow_undef) {
 		    //*n = 0; eprint (-1, fmt ("undefined [%s]\n", name));
 		    error (lineno, "undefined label in expr");
@@ -341,12 +888,15 @@ static vp_t expr (unsigned lineno, label_t mainlbl, bool allow_undef, unsigned p
 	    } else {
 		lbl->flags |= LABEL_USED;
 		v	    = lbl->value;
+		exprlast    = lbl;
+		if (reeval.rec) reeval_dep (lbl);
 	    }
 	}
 	else
 	    break;
 
 	// process
+	COUNT (items, 1);
 	if (op) {
 	    if (osp + 1 != vsp || osp >= max)
 		break;
@@ -382,9 +932,227 @@ static vp_t expr (unsigned lineno, label_t mainlbl, bool allow_undef, unsigned p
 	    sval[vsp++] = vv;
 	}
     }
+    phase (ph);
     return (vp_t) {p, sval[0]};
 }
 
+/*
+ * lazy equates: the expression text of every .EQU is kept, an equate with undefined
+ * references waits until first use or the end of the first pass, so equates resolve in
+ * any declaration order; constant ones are memoized for all passes
+ */
+typedef struct {
+    uint32_t	main;	    // main label for locals (label_ref + 1), 0 for none
+    uint32_t	pc;
+    uint32_t	lineno;
+    uint32_t	off;	    // text in equs.vtext
+    uint32_t	len;	    // expression chars, 0 until parsed
+    const char *file;
+} equ_t;
+
+static struct {
+    equ_t      *vequ;
+    unsigned	nequ;
+    unsigned	maxequ;
+    char       *vtext;
+    unsigned	ntext;
+    unsigned	maxtext;
+    uint64_t	deferred;   // waited for a later definition
+} equs;
+
+static bool equ_eval (label_t l, bool final) {
+    equ_t      *e    = &equs.vequ[l->equ - 1];
+    const char *file = source;
+    if (l->flags & LABEL_BUSY) {
+	// reported once, the cycle resolves with the current value
+	source = e->file;
+	error (e->lineno, "circular .EQU");
+	source = file;
+	l->flags &= ~LABEL_LAZY;
+	return true;
+    }
+
+    // the value does not count as references of the outer expr
+    unsigned labels = exprlabels, pcs = exprpc, undef = exprundef;
+    label_t  last   = exprlast;
+    label_t  main   = e->main ? label_at (e->main - 1) : NULL;
+    l->flags |= LABEL_BUSY;
+    source    = e->file;
+    vp_t   vp = expr (e->lineno, main, !final, e->pc, (uint8_t *) equs.vtext + e->off);
+    source    = file;
+    l->flags &= ~LABEL_BUSY;
+    if (vp.p) e->len = vp.p - (uint8_t *) equs.vtext - e->off;
+    bool ok   = vp.p && exprundef == undef;
+    if (ok) {
+	if (l->value != vp.v) label_moved (l);
+	l->value  = vp.v;
+	l->flags &= ~(LABEL_LAZY | LABEL_CONST);
+	if (exprlabels == labels && exprpc == pcs) l->flags |= LABEL_CONST;
+    }
+    exprlabels = labels;
+    exprpc     = pcs;
+    exprundef  = undef;
+    exprlast   = last;
+    return ok;
+}
+
+// record the rest of the line, the expression length is known after the first equ_eval
+static void equ_define (label_t l, label_t mainlbl, unsigned pc, unsigned lineno, uint8_t *p) {
+    if (equs.nequ == equs.maxequ) {
+	unsigned n  = equs.maxequ ? equs.maxequ * 2 : 64;
+	equs.vequ   = xrealloc (MEM_SYMBOLS, equs.vequ, equs.maxequ * sizeof (equ_t), n * sizeof (equ_t));
+	equs.maxequ = n;
+    }
+    unsigned len = strlen ((char *) p);
+    if (equs.ntext + len + 1 > equs.maxtext) {
+	unsigned n   = equs.maxtext ? equs.maxtext * 2 : 4096;
+	while (n < equs.ntext + len + 1) n *= 2;
+	equs.vtext   = xrealloc (MEM_NAMES, equs.vtext, equs.maxtext, n);
+	equs.maxtext = n;
+    }
+    memcpy (equs.vtext + equs.ntext, p, len);
+    equs.vtext[equs.ntext + len] = 0;
+    equs.vequ[equs.nequ] = (equ_t) {mainlbl ? label_ref (mainlbl) + 1 : 0, pc, lineno, equs.ntext, 0, source};
+    equs.ntext	+= len + 1;
+    l->equ	 = ++equs.nequ;
+    l->flags	|= LABEL_USED | LABEL_EQU | LABEL_LAZY;
+}
+
+// end of the first pass: every label is known, pending equates must resolve now
+static void equ_resolve (void) {
+    for (unsigned i = 0; i < nlabel + nlocal; i++) {
+	label_t l = i < nlabel ? &tlabel[i] : &tlocal[i - nlabel];
+	if (l->flags & LABEL_LAZY) {
+	    equs.deferred++;
+	    equ_eval (l, true);
+	}
+    }
+}
+
+static void equ_reset (void) {
+    equs.nequ	  = 0;
+    equs.ntext	  = 0;
+    equs.deferred = 0;
+}
+
+/*
+ * symbol snapshots: the constant equates of a run saved as fixed size records
+ * (--export-symbols) and mapped back as predefined symbols (--symbols)
+ */
+#define SYM_MAGIC	    "EONSYM\n"
+#define SYM_VERSION	    1
+
+typedef struct {
+    char	magic[8];
+    uint32_t	version;
+    uint32_t	namelen;    // MAX_CHAR_LABEL of the writer
+    uint32_t	count;
+    uint32_t	reserved;
+} symhdr_t;
+
+typedef struct {
+    uint32_t	value;
+    uint8_t	flags;
+    uint8_t	len;
+    char	name[MAX_CHAR_LABEL];
+} symrec_t;
+
+static struct {
+    const char *export;     // --export-symbols file
+    uint64_t	loaded;
+    uint64_t	exported;
+} syms;
+
+static void sym_load (const char *path) {
+    int fd = open (path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat (fd, &st) < 0) {
+	eprint (-1, fmt ("eonasm: can not open symbols [%s]: %m\n", path));
+	exit   (1);
+    }
+    const symhdr_t *h = st.st_size >= (off_t) sizeof (symhdr_t) ? mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close (fd);
+    if (h == MAP_FAILED || memcmp (h->magic, SYM_MAGIC, sizeof (h->magic)) || h->version != SYM_VERSION ||
+	h->namelen != MAX_CHAR_LABEL || sizeof (*h) + (uint64_t) h->count * sizeof (symrec_t) > (uint64_t) st.st_size) {
+	eprint (-1, fmt ("eonasm: bad symbols file [%s]\n", path));
+	exit   (1);
+    }
+
+    // a clash with the source shows as a duplicated label on the first pass
+    const symrec_t *r = (const symrec_t *) (h + 1);
+    for (uint32_t i = 0; i < h->count; i++, r++) {
+	label_t l = add_label (NULL, r->name, r->len, r->value, 0);
+	l->flags |= LABEL_USED | LABEL_EQU | LABEL_CONST;
+	l->seen   = UINT16_MAX;
+    }
+    syms.loaded += h->count;
+    munmap ((void *) h, st.st_size);
+}
+
+static void sym_export (const char *path) {
+    unsigned n = 0;
+    for (unsigned i = 0; i < nlabel; i++)
+	n += tlabel[i].equ && (tlabel[i].flags & LABEL_CONST);
+    size_t    size = sizeof (symhdr_t) + n * sizeof (symrec_t);
+    symhdr_t *h    = xrealloc (MEM_OUTPUT, NULL, 0, size);
+    memset (h, 0, size);
+    memcpy (h->magic, SYM_MAGIC, sizeof (h->magic));
+    h->version = SYM_VERSION;
+    h->namelen = MAX_CHAR_LABEL;
+    h->count   = n;
+    symrec_t *r = (symrec_t *) (h + 1);
+    for (unsigned i = 0; i < nlabel; i++) {
+	label_t l = &tlabel[i];
+	if (l->equ && (l->flags & LABEL_CONST)) {
+	    r->value = l->value;
+	    r->flags = LABEL_EQU | LABEL_CONST;
+	    r->len   = l->len;
+	    memcpy (r->name, l->name, MAX_CHAR_LABEL);
+	    r++;
+	}
+    }
+    int fd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || write (fd, h, size) != (ssize_t) size) {
+	eprint (-1, fmt ("eonasm: can not write symbols [%s]: %m\n", path));
+	exit   (1);
+    }
+    close (fd);
+    xrealloc (MEM_OUTPUT, h, size, 0);
+    syms.exported = n;
+}
+
+/*
+ * data literals: a plain decimal, $hex or 'c' element of .BYTE/.WORD/.LONG followed by ','
+ * or the end of the line is scanned here, anything else goes through expr
+ */
+static bool data_literal (uint8_t **pp, uint32_t *pv) {
+    uint8_t *p = *pp;
+    uint32_t v = 0;
+    while (*p && *p <= ' ') p++;
+    if (*p == '$' && isxdigit (p[1])) {
+	for (p++; isxdigit (*p); p++)
+	    v = (v << 4) | (isdigit (*p) ? *p - '0' : (*p | 32) - 'a' + 10);
+    } else if (isdigit (*p) || (*p == '-' && isdigit (p[1]))) {
+	bool minus = *p == '-';
+	for (p += minus; isdigit (*p);)
+	    v = v * 10 + *p++ - '0';
+	if (minus) v = 0 - v;
+    } else if (*p == '\'' && p[1] && p[2] == '\'') {
+	v  = p[1];
+	p += 3;
+    } else
+	return false;
+
+    // only a whole element
+    while (*p && *p <= ' ') p++;
+    if (*p && *p != ',' && *p != ';' && *p != '#')
+	return false;
+    COUNT (literals, 1);
+    *pp = p;
+    *pv = v;
+    return true;
+}
+
 /*
  * registers
  */
@@ -540,8 +1308,21 @@ struct arg_t {
     enum {_, R, N, M} k;
     int     rno;
     int     val;
+    uint8_t *txt;   // N: expression text
+    uint8_t tlen;
+    uint8_t ref;    // N: ARG_CONST, ARG_LABEL or ARG_PC
+    label_t lbl;    // N: last label in the expression
 };
 
+enum {ARG_CONST, ARG_LABEL, ARG_PC};
+
+static void arg_text (struct arg_t *a, uint8_t *txt, uint8_t *end, unsigned labels, unsigned pcs) {
+    a->txt  = txt;
+    a->tlen = end - txt;
+    a->ref  = exprpc != pcs ? ARG_PC : exprlabels != labels ? ARG_LABEL : ARG_CONST;
+    a->lbl  = a->ref == ARG_LABEL ? exprlast : NULL;
+}
+
 typedef struct tentry_t * tentry_t;
 struct tentry_t {
     uint8_t	op;
@@ -673,7 +1454,9 @@ static struct tentry_t tmatch[] = {
 };
 
 static tentry_t match (int op, int na, arg_t va) {
-    for (unsigned i = 0; i < sizeof (tmatch) / sizeof (tmatch[0]); i++)
+    COUNT (matches, 1);
+    for (unsigned i = 0; i < sizeof (tmatch) / sizeof (tmatch[0]); i++) {
+	COUNT (compares, 1);
 	if (tmatch[i].op == op && tmatch[i].na == na) {
 	    tentry_t e = &tmatch[i];
 	    for (int n = 0; n < na; n++)
@@ -683,30 +1466,981 @@ static tentry_t match (int op, int na, arg_t va) {
 		}
 	    if (e) return e;
 	}
+    }
     return NULL;
 }
 
+/*
+ * peephole optimizer (-O), shorter equivalents selected while encoding
+ */
+static struct {
+    bool	on;
+    uint64_t	bytes;	    // bytes saved on the last pass
+    uint64_t	rewrites;   // instructions rewritten on the last pass
+} peep;
+
+// alu op with immediate, returns the new length or -1 to keep it
+static int peephole_alu (unsigned w, int rd, int rs, int v, uint8_t *code) {
+    if ((w & 0xf000) != 0x3000 || rd == 15)
+	return -1;
+
+    // identities: rd = rs, a source 15 reads as zero here but as sp in mv
+    unsigned op = w & 0x0f;
+    if ((v == 0 && (op == 0x4 || op == 0x5 || op == 0x9 || op == 0xa || op == 0xb || op == 0xc || op == 0xd)) ||
+	(v == 1 && (op == 0x6 || op == 0x7 || op == 0xe || op == 0xf))) {
+	if (rd == rs)
+	    return 0;
+	if (rs == 15) {
+	    // and rd, zero, sp
+	    code[0] = 0x80 | rd;
+	    code[1] = 0xff;
+	    return 2;
+	}
+	// mv rd, rs
+	code[0] = 0x90 | rd;
+	code[1] = 0xf0 | rs;
+	return 2;
+    }
+
+    // zero: rd = 0
+    if (v == 0 && (op == 0x6 || op == 0x8 || op == 0xe)) {
+	// and rd, zero, sp
+	code[0] = 0x80 | rd;
+	code[1] = 0xff;
+	return 2;
+    }
+    return -1;
+}
+
+static void peephole_saved (bool out, unsigned from, unsigned to) {
+    if (out) {
+	peep.bytes += from - to;
+	peep.rewrites++;
+    }
+}
+
+/*
+ * literal pool (-P reg), wide li constants loaded from the .POOL table
+ * a 6 bytes li becomes a 4 bytes ld4i, the 4 bytes entry pays off from POOL_MIN_USES
+ */
+#define POOL_MIN_USES	    3
+#define POOL_MAX_SLOTS	    8190    // ld4i offset range
+
+typedef struct {
+    char       *key;	    // '#' hex value, or expression text
+    unsigned	len;
+    uint32_t	hash;
+    uint32_t	value;
+    unsigned	uses;	    // wide li uses on this pass
+    int 	slot;	    // pool slot or -1, sticky so sizes converge
+} lit_t;
+
+static struct {
+    int 	base;	    // base register, -1 when off
+    lit_t      *vlit;
+    unsigned	nlit;
+    unsigned	maxlit;
+    unsigned   *vslot;	    // literal per slot
+    unsigned	nslot;
+    unsigned	pad;	    // alignment from .POOL to the first slot
+    bool	placed;     // .POOL seen on this pass
+    uint64_t	loads;	    // pooled li on the last pass
+} pool = {.base = -1};
+
+// literal for a wide li arg, NULL when the value depends on the pc
+static lit_t * pool_use (label_t mainlbl, struct arg_t *a, uint32_t value) {
+    if (a->ref == ARG_PC)
+	return NULL;
+
+    // key: constants by value, symbolic by text (locals qualified by their main label)
+    static char key[MAX_CHAR_LABEL + MAX_LINE + 2];
+    unsigned	len = 0;
+    if (a->ref == ARG_CONST)
+	len = strlen (strcpy (key, fmt ("#%w%w", value >> 16, value)));
+    else {
+	if (mainlbl && memchr (a->txt, '.', a->tlen)) {
+	    memcpy (key, mainlbl->name, mainlbl->len);
+	    len = mainlbl->len;
+	    key[len++] = ':';
+	}
+	for (unsigned i = 0; i < a->tlen; i++)
+	    if (a->txt[i] > ' ')
+		key[len++] = toupper (a->txt[i]);
+    }
+    uint32_t h = 2166136261u;
+    for (unsigned i = 0; i < len; i++)
+	h = (h ^ (uint8_t) key[i]) * 16777619u;
+
+    // find, the same text with another value on this pass (.REPT, macros) is the next literal
+    lit_t *l = pool.vlit;
+    for (lit_t *e = l + pool.nlit; l < e; l++)
+	if (l->hash == h && l->len == len && !memcmp (l->key, key, len) && (!l->uses || l->value == value))
+	    break;
+
+    // or add
+    if (l == pool.vlit + pool.nlit) {
+	if (pool.nlit == pool.maxlit) {
+	    unsigned n	= pool.maxlit ? pool.maxlit * 2 : 64;
+	    pool.vlit	= xrealloc (MEM_SYMBOLS, pool.vlit, pool.maxlit * sizeof (lit_t), n * sizeof (lit_t));
+	    pool.maxlit = n;
+	}
+	l	= &pool.vlit[pool.nlit++];
+	l->key	= memcpy (xrealloc (MEM_NAMES, NULL, 0, len), key, len);
+	l->len	= len;
+	l->hash = h;
+	l->uses = 0;
+	l->slot = -1;
+    }
+    l->value = value;
+    l->uses++;
+    return l;
+}
+
+// pass end: literals used enough get a slot for the next pass
+static void pool_pass (bool *pmore) {
+    for (unsigned i = 0; i < pool.nlit; i++) {
+	lit_t *l = &pool.vlit[i];
+	if (pool.placed && l->slot < 0 && l->uses >= POOL_MIN_USES && pool.nslot < POOL_MAX_SLOTS) {
+	    if ((pool.nslot & 63) == 0)
+		pool.vslot = xrealloc (MEM_IR, pool.vslot, pool.nslot * sizeof (unsigned), (pool.nslot + 64) * sizeof (unsigned));
+	    l->slot = pool.nslot;
+	    pool.vslot[pool.nslot++] = i;
+	    *pmore  = true;
+	}
+	l->uses = 0;
+    }
+}
+
+static void pool_reset (void) {
+    for (unsigned i = 0; i < pool.nlit; i++)
+	xrealloc (MEM_NAMES, pool.vlit[i].key, pool.vlit[i].len, 0);
+    pool.base	= -1;
+    pool.vslot	= xrealloc (MEM_IR, pool.vslot, (pool.nslot + 63) / 64 * 64 * sizeof (unsigned), 0);
+    pool.nlit	= pool.nslot = 0;
+    pool.placed = false;
+    pool.loads	= 0;
+}
+
+/*
+ * branch relaxation: a conditional branch out of range becomes the inverted branch over a jmp
+ */
+static uint64_t relaxed;    // long form branches on the last pass
+
+static unsigned branch_invert (unsigned w) {
+    unsigned ra = (w >> 8) & 0x0f;
+    unsigned rb = (w >> 4) & 0x0f;
+    switch (w & 0x0f) {
+	case 0: case 1: return w ^ 1;				    // beq <-> bne, bz <-> bnz
+	case 2: return 0x2004 | (rb << 8) | (ra << 4);		    // a < b  -> b <= a
+	case 4: return 0x2002 | (rb << 8) | (ra << 4);		    // a <= b -> b < a
+	case 3: return 0x2005 | (rb << 8) | (ra << 4);
+	case 5: return 0x2003 | (rb << 8) | (ra << 4);
+	default: return w;
+    }
+}
+
+/*
+ * branch distance report (--branches margin): per routine histogram of 'B' distances,
+ * long forms and short branches within margin bytes of the +-32K halfword limit
+ */
+#define BRANCH_BUCKETS	    6	    // <64 <512 <4K <32K <64K long
+
+static const char *bucketname[BRANCH_BUCKETS] = {"<64", "<512", "<4K", "<32K", "<64K", "long"};
+
+typedef struct {
+    int 	label;	    // global label index, -1 before the first one
+    uint64_t	count[BRANCH_BUCKETS];
+    uint64_t	max;	    // longest short form distance in bytes
+} routine_t;
+
+static struct {
+    bool	on;
+    unsigned	margin;
+    routine_t  *vrout;
+    unsigned	nrout;
+    unsigned	maxrout;
+    uint64_t	count[BRANCH_BUCKETS];
+    uint64_t	near;
+} branches;
+
+static void branch_note (label_t mainlbl, unsigned lineno, int dist, bool islong) {
+    int 	label = mainlbl ? (int) (mainlbl - tlabel) : -1;
+    routine_t  *r     = branches.nrout ? &branches.vrout[branches.nrout - 1] : NULL;
+    if (!r || r->label != label) {
+	// routines come back only across sections
+	r = NULL;
+	for (unsigned i = 0; i < branches.nrout && !r; i++)
+	    if (branches.vrout[i].label == label)
+		r = &branches.vrout[i];
+    }
+    if (!r) {
+	if (branches.nrout == branches.maxrout) {
+	    unsigned n	     = branches.maxrout ? branches.maxrout * 2 : 64;
+	    branches.vrout    = xrealloc (MEM_IR, branches.vrout, branches.maxrout * sizeof (routine_t), n * sizeof (routine_t));
+	    branches.maxrout = n;
+	}
+	r = &branches.vrout[branches.nrout++];
+	memset (r, 0, sizeof (*r));
+	r->label = label;
+    }
+
+    // bucket by distance, headroom against the short form range
+    unsigned d = dist < 0 ? -dist : dist;
+    unsigned b = islong ? 5 : d < 64 ? 0 : d < 512 ? 1 : d < 4096 ? 2 : d < 32768 ? 3 : 4;
+    r->count[b]++;
+    branches.count[b]++;
+    if (islong)
+	return;
+    if (d > r->max) r->max = d;
+    unsigned room = dist < 0 ? 65536 - d : 65534 - d;
+    if (room < branches.margin) {
+	branches.near++;
+	warning (source, lineno, "branch near the range limit", NULL, 0);
+	eprint (-1, fmt ("eonasm warning at line %5 of %s: branch %U bytes from the range limit\n",
+	    lineno, source, (unsigned long long) room));
+    }
+}
+
+static void branch_report (void) {
+    char line[MAX_LINE];
+    strcpy (line, "eonasm branches: routine");
+    for (unsigned b = 0; b < BRANCH_BUCKETS; b++)
+	strcat (line, fmt ("\t%s", bucketname[b]));
+    eprint (-1, fmt ("%s\tmax\n", line));
+    for (unsigned i = 0; i < branches.nrout; i++) {
+	routine_t *r = &branches.vrout[i];
+	strcpy (line, fmt ("eonasm branches: %s", r->label < 0 ? "-" : tlabel[r->label].name));
+	for (unsigned b = 0; b < BRANCH_BUCKETS; b++)
+	    strcat (line, fmt ("\t%U", (unsigned long long) r->count[b]));
+	eprint (-1, fmt ("%s\t%U\n", line, (unsigned long long) r->max));
+    }
+    uint64_t total = 0;
+    for (unsigned b = 0; b < BRANCH_BUCKETS; b++)
+	total += branches.count[b];
+    eprint (-1, fmt ("eonasm: %U branches, %U relaxed to the long form, %U within %U bytes of the limit\n",
+	(unsigned long long) total, (unsigned long long) branches.count[5], (unsigned long long) branches.near,
+	(unsigned long long) branches.margin));
+}
+
+static void branch_reset (void) {
+    branches.on     = false;
+    branches.margin = 0;
+    branches.nrout  = 0;
+    branches.near   = 0;
+    memset (branches.count, 0, sizeof (branches.count));
+}
+
+/*
+ * loop head alignment (-A size), nop padding before backward branch targets
+ */
+static struct {
+    unsigned	size;	    // boundary, 0 when off
+    uint64_t	heads;	    // aligned labels on the last pass
+    uint64_t	bytes;	    // padding on the last pass
+} loops;
+
+static void loop_head (label_t lbl, unsigned target, bool *pmore) {
+    if (lbl && lbl->value == target && !(lbl->flags & (LABEL_EQU | LABEL_LOOP))) {
+	lbl->flags |= LABEL_LOOP;
+	*pmore	    = true;
+    }
+}
+
+static unsigned loop_align (unsigned pc, bool out, bool listing) {
+    unsigned pad = (loops.size - (pc & (loops.size - 1))) & (loops.size - 1);
+    if (!pad || (pc & 1))
+	return pc;
+    if (out) {
+	loops.heads++;
+	loops.bytes += pad;
+	for (unsigned i = 0; i < pad; i += 2) {
+	    emit (pc + i, 0x0f);
+	    emit (pc + i + 1, 0xf1);
+	}
+    }
+    if (listing)
+	for (unsigned i = 0; i < pad;) {
+	    oprint (-1, fmt ("%w ", pc + i));
+	    for (unsigned n = 0; n < 6; n += 2, i += 2)
+		if (i < pad) oprint (-1, "0FF1");
+			else oprint (4, "    ");
+	    oprint (1, "\n");
+	}
+    return pc + pad;
+}
+
+/*
+ * sections, separate address streams (.SECTION name [, origin], .HOT, .COLD)
+ * a section without origin is placed after the previous one, as it ended on the last pass;
+ * .COLD is a section of its own and .HOT goes back to TEXT, so hot paths stay together
+ */
+static struct {
+    char	name[MAX_CHAR_LABEL];
+    unsigned	len;
+    bool	fixed;	    // origin from -S or .SECTION
+    bool	entered;    // seen on this pass
+    unsigned	origin;
+    unsigned	pc;
+    unsigned	lo;	    // lowest address used on this pass
+    unsigned	hi;	    // end of the highest address used on this pass
+} vsect[MAX_SECTIONS];
+static unsigned nsect;
+static unsigned cursect;
+
+static int section_find (const char *name, unsigned len) {
+    for (unsigned i = 0; i < nsect; i++)
+	if (vsect[i].len == len && !memcmp (vsect[i].name, name, len))
+	    return i;
+    if (nsect == MAX_SECTIONS || len >= MAX_CHAR_LABEL)
+	return -1;
+    memset (&vsect[nsect], 0, sizeof (vsect[0]));
+    memcpy (vsect[nsect].name, name, len);
+    vsect[nsect].len = len;
+    return nsect++;
+}
+
+// pass start: every section back to its origin, assembly starts in the first one
+static unsigned section_begin (void) {
+    if (!nsect) {
+	section_find ("TEXT", 4);
+	vsect[0].fixed = true;
+    }
+    for (unsigned i = 0; i < nsect; i++) {
+	vsect[i].pc	 = vsect[i].origin;
+	vsect[i].lo	 = UINT_MAX;
+	vsect[i].hi	 = 0;
+	vsect[i].entered = false;
+    }
+    vsect[0].entered = true;
+    cursect	     = 0;
+    return vsect[0].pc;
+}
+
+static unsigned section_switch (unsigned lineno, const char *name, unsigned len, bool fixed, unsigned origin, unsigned pc, bool *pmore) {
+    vsect[cursect].pc = pc;
+    int i = section_find (name, len);
+    if (i < 0) {
+	error (lineno, "too many sections");
+	return pc;
+    }
+    if (fixed && (!vsect[i].fixed || vsect[i].origin != origin)) {
+	if (vsect[i].entered && vsect[i].fixed)
+	    error (lineno, "section origin redefined");
+	vsect[i].fixed	= true;
+	vsect[i].origin = origin;
+	vsect[i].pc	= origin;
+	*pmore		= true;
+    }
+    vsect[i].entered = true;
+    cursect	     = i;
+    return vsect[i].pc;
+}
+
+static void section_use (unsigned pc, unsigned bytes) {
+    if (pc < vsect[cursect].lo)		vsect[cursect].lo = pc;
+    if (pc + bytes > vsect[cursect].hi) vsect[cursect].hi = pc + bytes;
+}
+
+// pass end: chained origins for the next pass
+static void section_end (unsigned pc, bool *pmore) {
+    vsect[cursect].pc = pc;
+    for (unsigned i = 1; i < nsect; i++) {
+	if (!vsect[i].fixed) {
+	    unsigned end = vsect[i - 1].hi > vsect[i - 1].origin ? vsect[i - 1].hi : vsect[i - 1].origin;
+	    unsigned at  = (end + 3) & ~3u;
+	    if (at != vsect[i].origin) {
+		vsect[i].origin = at;
+		*pmore		= true;
+	    }
+	}
+    }
+}
+
+// last pass: sections must not overlap, reported on the later one
+static void section_check (void) {
+    for (unsigned i = 0; i < nsect; i++)
+	for (unsigned j = i + 1; j < nsect; j++)
+	    if (vsect[i].lo < vsect[j].hi && vsect[j].lo < vsect[i].hi) {
+		eprint (-1, fmt ("eonasm error: sections %s and %s overlap\n", vsect[i].name, vsect[j].name));
+		vdiag[errcount] = (diag_t) {source, 0, "sections overlap", vsect[j].name, vsect[j].len};
+		errcount++;
+		if (errcount >= MAX_ERRORS) exit (1);
+	    }
+}
+
+/*
+ * macros (.MACRO name [param [, param]*] ... .ENDM)
+ * bodies are compiled once on pass 0 into text, \param and \@ segments, so expanding needs
+ * no search for parameters; each expansion is stitched from segments into the line buffer
+ * and its lines are lexed like source lines on every pass
+ */
+enum {SEG_TEXT, SEG_PARAM, SEG_UNIQUE, SEG_EOL};
+
+typedef struct {
+    uint8_t	kind;
+    uint8_t	param;
+    uint16_t	len;	    // SEG_TEXT
+    uint32_t	off;	    // SEG_TEXT, into vmtext
+} seg_t;
+
+typedef struct {
+    char	name[MAX_CHAR_LABEL];
+    unsigned	len;
+    unsigned	nparam;
+    unsigned	seg;	    // first segment
+    unsigned	nseg;
+    unsigned	text;	    // first text byte
+    uint32_t	key;	    // .REPT: source file and line, 0 inside an expansion
+} macro_t;
+
+typedef struct {
+    unsigned	macro;
+    unsigned	seg;	    // next segment
+    unsigned	id;	    // \@
+    unsigned	left;	    // iterations left
+    unsigned	iter;
+    int 	var;	    // .REPT iteration symbol (global label index) or -1
+    bool	temp;	    // body released when the frame ends
+    uint8_t	aoff[MAX_PARAMS];
+    uint8_t	alen[MAX_PARAMS];
+    char	atext[MAX_LINE];
+} frame_t;
+
+static struct {
+    macro_t    *vmacro;
+    unsigned	nmacro, maxmacro;
+    seg_t      *vseg;
+    unsigned	nseg, maxseg;
+    char       *vmtext;
+    unsigned	ntext, maxtext;
+    macro_t	def;	    // macro being defined
+    bool	defining;   // inside .MACRO/.ENDM
+    bool	compile;    // body lines are compiled
+    bool	rept;	    // defining a .REPT block
+    unsigned	nest;	    // nested .REPT in a .REPT body
+    int 	defidx;     // .REPT: compiled block
+    unsigned	rcount;     // .REPT: iterations
+    int 	rvar;
+    char	param[MAX_PARAMS][MAX_CHAR_LABEL];
+    unsigned	plen[MAX_PARAMS];
+    unsigned	count;	    // expansions on this pass, \@ value
+    unsigned	depth;	    // active expansions
+    frame_t	vframe[MAX_MACRO_DEPTH];
+} mac;
+
+static int macro_find (const char *name, unsigned len) {
+    for (unsigned i = 0; i < mac.nmacro; i++)
+	if (mac.vmacro[i].len == len && !memcmp (mac.vmacro[i].name, name, len))
+	    return i;
+    return -1;
+}
+
+static void macro_seg (unsigned kind, unsigned param, const char *text, unsigned len) {
+    if (kind == SEG_TEXT && !len)
+	return;
+    if (mac.nseg == mac.maxseg) {
+	unsigned n   = mac.maxseg ? mac.maxseg * 2 : 256;
+	mac.vseg     = xrealloc (MEM_IR, mac.vseg, mac.maxseg * sizeof (seg_t), n * sizeof (seg_t));
+	mac.maxseg   = n;
+    }
+    if (mac.ntext + len > mac.maxtext) {
+	unsigned n   = mac.maxtext ? mac.maxtext * 2 : 4096;
+	while (n < mac.ntext + len) n *= 2;
+	mac.vmtext   = xrealloc (MEM_IR, mac.vmtext, mac.maxtext, n);
+	mac.maxtext  = n;
+    }
+    memcpy (mac.vmtext + mac.ntext, text, len);
+    mac.vseg[mac.nseg++] = (seg_t) {kind, param, len, mac.ntext};
+    mac.ntext += len;
+}
+
+// .MACRO: name and params, body lines follow up to .ENDM (compiled on pass 0 only)
+static void macro_begin (unsigned lineno, uint8_t *p, unsigned pass) {
+    macro_t *m	 = &mac.def;
+    mac.defining = true;
+    mac.rept	 = false;
+    mac.compile  = pass == 0;
+    if (!mac.compile)
+	return;
+    memset (m, 0, sizeof (*m));
+    m->seg  = mac.nseg;
+    m->text = mac.ntext;
+
+    // name
+    while (*p && *p <= ' ') p++;
+    for (; (isalnum (*p) || *p == '_') && m->len < MAX_CHAR_LABEL; p++)
+	m->name[m->len++] = toupper (*p);
+    if (!m->len || macro_find (m->name, m->len) >= 0)
+	error (lineno, m->len ? "duplicated macro" : ".MACRO without name");
+
+    // params
+    for (;;) {
+	while (*p && *p <= ' ') p++;
+	if (!isalpha (*p)) break;
+	if (m->nparam == MAX_PARAMS) {
+	    error (lineno, "too many macro params");
+	    break;
+	}
+	unsigned n = 0;
+	for (; (isalnum (*p) || *p == '_') && n < MAX_CHAR_LABEL; p++)
+	    mac.param[m->nparam][n++] = toupper (*p);
+	mac.plen[m->nparam++] = n;
+	while (*p && *p <= ' ') p++;
+	if (*p != ',') break;
+	p++;
+    }
+}
+
+// .REPT count [, var]: body lines follow up to .ENDR, compiled once per source line
+// (blocks inside an expansion may differ per expansion and are compiled every time)
+static void rept_begin (unsigned lineno, unsigned count, int var) {
+    uint32_t key = mac.depth ? 0 : ((srcidx + 1) << 20) | lineno;
+    mac.defining = true;
+    mac.rept	 = true;
+    mac.nest	 = 0;
+    mac.rcount	 = count;
+    mac.rvar	 = var;
+    mac.defidx	 = -1;
+    for (unsigned i = 0; key && i < mac.nmacro; i++)
+	if (mac.vmacro[i].key == key)
+	    mac.defidx = i;
+    mac.compile  = mac.defidx < 0;
+    if (mac.compile) {
+	memset (&mac.def, 0, sizeof (mac.def));
+	mac.def.seg  = mac.nseg;
+	mac.def.text = mac.ntext;
+	mac.def.key  = key;
+    }
+}
+
+// body line, true at the closing .ENDM/.ENDR
+static bool macro_line (uint8_t *line) {
+    macro_t *m = &mac.def;
+    uint8_t *b = line;
+    while (*b && *b <= ' ') b++;
+    if (mac.rept && is_directive (b, "REPT"))
+	mac.nest++;
+    else if (mac.rept ? is_directive (b, "ENDR") && !mac.nest-- : is_directive (b, "ENDM")) {
+	mac.defining = false;
+	if (!mac.compile)
+	    return true;
+	m->nseg = mac.nseg - m->seg;
+	if (mac.nmacro == mac.maxmacro) {
+	    unsigned n	 = mac.maxmacro ? mac.maxmacro * 2 : 32;
+	    mac.vmacro	 = xrealloc (MEM_SYMBOLS, mac.vmacro, mac.maxmacro * sizeof (macro_t), n * sizeof (macro_t));
+	    mac.maxmacro = n;
+	}
+	mac.defidx		 = mac.nmacro;
+	mac.vmacro[mac.nmacro++] = *m;
+	return true;
+    }
+    if (!mac.compile)
+	return false;
+
+    // segments
+    uint8_t *t = line;
+    for (b = line; *b;) {
+	if (*b != '\\') {
+	    b++;
+	    continue;
+	}
+	if (b[1] == '@') {
+	    macro_seg (SEG_TEXT, 0, (char *) t, b - t);
+	    macro_seg (SEG_UNIQUE, 0, NULL, 0);
+	    t = b += 2;
+	    continue;
+	}
+	char	 id[MAX_CHAR_LABEL];
+	unsigned n = 0;
+	uint8_t *e = b + 1;
+	for (; (isalnum (*e) || *e == '_') && n < MAX_CHAR_LABEL; e++)
+	    id[n++] = toupper (*e);
+	unsigned i = 0;
+	while (i < m->nparam && (mac.plen[i] != n || memcmp (mac.param[i], id, n))) i++;
+	if (!n || i == m->nparam) {
+	    b++;
+	    continue;
+	}
+	macro_seg (SEG_TEXT, 0, (char *) t, b - t);
+	macro_seg (SEG_PARAM, i, NULL, 0);
+	t = b = e;
+    }
+    macro_seg (SEG_TEXT, 0, (char *) t, b - t);
+    macro_seg (SEG_EOL, 0, NULL, 0);
+    return false;
+}
+
+// invocation: arguments split at top level commas
+static void macro_expand (unsigned lineno, int i, uint8_t *p) {
+    if (mac.depth == MAX_MACRO_DEPTH) {
+	error (lineno, "macro expansion too deep");
+	return;
+    }
+    macro_t *m = &mac.vmacro[i];
+    frame_t *f = &mac.vframe[mac.depth];
+    f->macro = i;
+    f->seg   = m->seg;
+    f->left  = 1;
+    f->var   = -1;
+    f->temp  = false;
+    f->id    = mac.count++;
+    unsigned n = 0, na = 0;
+    while (*p && *p <= ' ') p++;
+    while (*p && *p != ';' && *p != '\n' && na < MAX_PARAMS) {
+	f->aoff[na] = n;
+	int depth   = 0;
+	for (char q = 0; *p && (q || depth || (*p != ',' && *p != ';' && *p != '\n')); p++) {
+	    if (q)
+		q = *p == q ? 0 : q;
+	    else if (*p == '"' || *p == '\'')
+		q = *p;
+	    else
+		depth += (*p == '(') - (*p == ')');
+	    f->atext[n++] = *p;
+	}
+	while (n > f->aoff[na] && f->atext[n - 1] <= ' ') n--;
+	f->alen[na] = n - f->aoff[na];
+	na++;
+	if (*p != ',') break;
+	for (p++; *p && *p <= ' ';) p++;
+    }
+    for (; na < MAX_PARAMS; na++)
+	f->alen[na] = 0;
+    mac.depth++;
+}
+
+// .ENDR: replicate the block
+static void rept_expand (unsigned lineno) {
+    macro_t *m = &mac.vmacro[mac.defidx];
+    if (mac.depth == MAX_MACRO_DEPTH)
+	error (lineno, "macro expansion too deep");
+    if (mac.depth == MAX_MACRO_DEPTH || !mac.rcount) {
+	if (!m->key) {
+	    // release a temporary block
+	    mac.nseg  = m->seg;
+	    mac.ntext = m->text;
+	    mac.nmacro--;
+	}
+	return;
+    }
+    frame_t *f = &mac.vframe[mac.depth++];
+    f->macro = mac.defidx;
+    f->seg   = m->seg;
+    f->id    = mac.count++;
+    f->left  = mac.rcount;
+    f->iter  = 0;
+    f->var   = mac.rvar;
+    f->temp  = !m->key;
+    if (f->var >= 0) {
+	tlabel[f->var].value = 0;
+	label_moved (&tlabel[f->var]);
+    }
+}
+
+// next line: from the innermost expansion, or the source file
+static bool next_line (uint8_t *buf, unsigned bytes, uint32_t *plineno) {
+    while (mac.depth) {
+	frame_t  *f = &mac.vframe[mac.depth - 1];
+	macro_t  *m = &mac.vmacro[f->macro];
+	unsigned  n = 0;
+	bool	eol = false;
+	for (seg_t *s = &mac.vseg[f->seg]; !eol && f->seg < m->seg + m->nseg; s++, f->seg++) {
+	    const char *t   = NULL;
+	    unsigned	len = 0;
+	    char	id[12];
+	    switch (s->kind) {
+		case SEG_TEXT:	 t = mac.vmtext + s->off; len = s->len; break;
+		case SEG_PARAM:  t = f->atext + f->aoff[s->param]; len = f->alen[s->param]; break;
+		case SEG_UNIQUE: {
+			char	*d = id + sizeof (id);
+			unsigned v = f->id;
+			do *--d = '0' + v % 10; while (v /= 10);
+			t   = d;
+			len = id + sizeof (id) - d;
+		    } break;
+		default:	 eol = true; break;
+	    }
+	    if (n + len >= bytes) {
+		error (*plineno, "macro line too long");
+		len = 0;
+	    }
+	    memcpy (buf + n, t, len);
+	    n += len;
+	}
+	buf[n] = 0;
+	if (eol)
+	    return true;
+
+	// next iteration
+	if (--f->left) {
+	    f->seg = m->seg;
+	    f->id  = mac.count++;
+	    if (f->var >= 0) {
+		tlabel[f->var].value = ++f->iter;
+		label_moved (&tlabel[f->var]);
+	    }
+	    continue;
+	}
+	if (f->temp) {
+	    mac.nseg  = m->seg;
+	    mac.ntext = m->text;
+	    mac.nmacro--;
+	}
+	mac.depth--;
+    }
+    return src_line (buf, plineno);
+}
+
+/*
+ * conditional assembly (.IF expr, .IFDEF name, .IFNDEF name, .ELSE, .ENDIF)
+ * lines of a skipped block are only checked for nested conditionals, never lexed
+ */
+static struct {
+    unsigned	depth;
+    bool	taken[MAX_IF_DEPTH];	// a branch of the level was assembled
+    bool	inelse[MAX_IF_DEPTH];
+    unsigned	skip;			// skipped levels, 0 when assembling
+    uint64_t	lines;			// skipped lines on the last pass
+} cond;
+
+static void cond_if (unsigned lineno, bool value) {
+    if (cond.skip) {
+	cond.skip++;
+	return;
+    }
+    if (cond.depth == MAX_IF_DEPTH) {
+	error (lineno, ".IF nested too deep");
+	return;
+    }
+    cond.taken[cond.depth]  = value;
+    cond.inelse[cond.depth] = false;
+    cond.depth++;
+    cond.skip = !value;
+}
+
+static void cond_else (unsigned lineno) {
+    if (cond.skip > 1)
+	return;
+    if (!cond.depth || cond.inelse[cond.depth - 1]) {
+	error (lineno, cond.depth ? "duplicated .ELSE" : ".ELSE without .IF");
+	return;
+    }
+    cond.inelse[cond.depth - 1] = true;
+    cond.skip			= cond.taken[cond.depth - 1];
+    cond.taken[cond.depth - 1]	= true;
+}
+
+static void cond_endif (unsigned lineno) {
+    if (cond.skip > 1) {
+	cond.skip--;
+	return;
+    }
+    if (!cond.depth) {
+	error (lineno, ".ENDIF without .IF");
+	return;
+    }
+    cond.depth--;
+    cond.skip = 0;
+}
+
+// skipped line: only conditionals count, after an optional label
+static void cond_skip (uint8_t *p, unsigned lineno, bool out) {
+    if (*p > ' ')
+	while (*p == '.' || *p == ':' || *p == '_' || isalnum (*p)) p++;
+    while (*p && *p <= ' ') p++;
+    if (out) cond.lines++;
+    if (*p != '.')
+	return;
+    if (is_directive (p, "IF") || is_directive (p, "IFDEF") || is_directive (p, "IFNDEF"))
+	cond_if (lineno, false);
+    else if (is_directive (p, "ELSE"))
+	cond_else (lineno);
+    else if (is_directive (p, "ENDIF"))
+	cond_endif (lineno);
+}
+
+/*
+ * unreachable code: instructions after an unconditional transfer up to the next label
+ * (--unreachable reports every run, --strip-unreachable drops them)
+ */
+static struct {
+    bool	report;
+    bool	strip;
+    bool	dead;	    // after bra, jmp, ret, eret, sret or iret
+    bool	run;	    // current run already recorded
+    uint64_t	runs;	    // on the last pass
+    uint64_t	insns;
+    uint64_t	bytes;
+} unreach;
+
+static unsigned unreachable (unsigned lineno, unsigned bytes, bool out) {
+    if (out) {
+	unreach.insns++;
+	unreach.bytes += bytes;
+	if (!unreach.run) {
+	    unreach.runs++;
+	    warning (source, lineno, "unreachable code", NULL, 0);
+	    if (unreach.report)
+		eprint (-1, fmt ("eonasm warning at line %5 of %s: unreachable code\n", lineno, source));
+	}
+    }
+    unreach.run = true;
+    return unreach.strip ? 0 : bytes;
+}
+
+/*
+ * tail call fusion and branch threading (-T)
+ * jal X; ret becomes jmp X without the ret, branches to a bra/jmp go to its target
+ * and a bra/jmp to a ret becomes the ret; all decisions depend on the source only
+ */
+#define TRANSFER_CYCLES     2	    // estimated cost of a taken bra, jmp or ret
+#define MAX_THREAD	    8	    // hops followed
+
+static struct {
+    bool	on;
+    bool	has;	    // label waiting for its instruction
+    uint32_t	label;
+    bool	jal;	    // previous instruction a jal
+    unsigned	jalst;
+    uint64_t	fused;	    // on the last pass
+    uint64_t	threaded;
+    uint64_t	hops;
+    uint64_t	bytes;
+} tail;
+
+// code label an arg names exactly, NULL otherwise
+static label_t tail_label (struct arg_t *a) {
+    label_t l = a->lbl;
+    return l && !(l->flags & LABEL_EQU) && l->value == a->val ? l : NULL;
+}
+
+// the pending jal is not followed by its ret, undo a fusion left by an earlier pass
+static void tail_break (bool *pmore) {
+    uint8_t *j = tail.jal ? stmt_state (tail.jalst) : NULL;
+    if (j && (*j & STMT_TAIL)) {
+	*j    &= ~STMT_TAIL;
+	*pmore = true;
+    }
+    tail.jal = false;
+}
+
+// returns true when the instruction is dropped, may change its word and kind
+static bool tail_insn (unsigned st, int op, label_t lbl, struct arg_t *va, unsigned *pw, int *pk, bool out, bool *pmore) {
+    // what sits at the pending label
+    if (tail.has) {
+	label_t  l = label_at (tail.label);
+	label_t  t = op == OP_BRA || (op == OP_JMP && *pk == 'J') ? tail_label (&va[0]) : NULL;
+	uint8_t  f = op == OP_RET ? LABEL_RET : t ? LABEL_BRA : 0;
+	uint32_t r = t ? label_ref (t) : 0;
+	if ((l->flags & (LABEL_RET | LABEL_BRA)) != f || (t && l->thread != r)) {
+	    // forward targets resolve on the next pass
+	    l->flags  = (l->flags & ~(LABEL_RET | LABEL_BRA)) | f;
+	    l->thread = r;
+	    *pmore    = true;
+	}
+	tail.has = false;
+    }
+
+    // jal; ret, checked on every pass: a .REPT count that changes shifts statement numbers
+    uint8_t *s	  = stmt_state (st);
+    bool     fuse = op == OP_RET && tail.jal && !lbl;
+    if (fuse) {
+	uint8_t *j = stmt_state (tail.jalst);
+	if (!(*j & STMT_TAIL) || !(*s & STMT_GONE)) {
+	    *j	  |= STMT_TAIL;
+	    *s	  |= STMT_GONE;
+	    *pmore = true;
+	}
+    } else
+	tail_break (pmore);
+    uint8_t stale = (op != OP_RET || !fuse ? STMT_GONE : 0) | (op != OP_JAL ? STMT_TAIL : 0);
+    if (*s & stale) {
+	*s    &= ~stale;
+	*pmore = true;
+    }
+    tail.jal   = op == OP_JAL;
+    tail.jalst = st;
+    if (*s & STMT_GONE) {
+	if (out) {
+	    tail.fused++;
+	    tail.bytes += 2;
+	}
+	return true;
+    }
+    if (*s & STMT_TAIL)
+	*pw ^= 1;   // jal -> jmp, undone by tail_break when no ret follows
+
+    // follow bra/jmp chains from the target
+    struct arg_t *a = *pk == 'B' || *pk == 'J' ? &va[0] : *pk == '!' ? &va[1] : *pk == 'b' ? &va[2] : NULL;
+    label_t	  t = a ? tail_label (a) : NULL;
+    unsigned	  n = 0;
+    for (; t && (t->flags & LABEL_BRA) && n < MAX_THREAD; n++)
+	t = label_at (t->thread);
+    if (!t || (t->flags & LABEL_BRA))
+	return false;
+    bool ret = (t->flags & LABEL_RET) && (*pw == 0x2ff0 || *pw == 0x0ffc);
+    if (out && (n || ret)) {
+	tail.threaded++;
+	tail.hops += n + ret;
+    }
+    if (ret) {
+	if (out) tail.bytes += *pk == 'J' ? 4 : 2;
+	*pw = 0x0fe0;
+	*pk = 'N';
+    } else if (n) {
+	a->val = t->value;
+	a->lbl = t;
+    }
+    return false;
+}
+
 /*
  * two pass assembler
  */
-static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool listing, bool *pmore) {
+static unsigned assemble (unsigned src, unsigned pass, bool out, unsigned pc, bool listing, bool *pmore) {
     static char     tmp[MAX_LINE];
     static uint8_t  buffer[MAX_LINE];
-    static uint8_t  code[MAX_LINE];
+    static uint8_t  code[MAX_LINE * 2];    // .LONG 1,1,... makes 4 bytes of 2 chars
     uint32_t lineno = 0;
     label_t mainlbl = NULL;
     bool    ended   = false;
-    while (!ended && readline (fd, buffer, sizeof (buffer), ++lineno)) {
+    mac.depth	 = 0;
+    unreach.dead = false;
+    tail.has	 = tail.jal = false;
+    inc.depth	 = 1;
+    inc.vframe[0].src  = src;
+    inc.vframe[0].line = 0;
+    for (phase (PH_READ); !ended && next_line (buffer, sizeof (buffer), &lineno); phase (PH_READ)) {
 	uint8_t *p = buffer;
+	phase (PH_LEX);
+	stats.lines++;
+	unsigned st = stmt++;
+	reeval.rec  = false;
 
 	// line bytes
 	unsigned bytes = 0;
 	unsigned space = 0;
+	bool	  lits = false;
 	bool	   org = false;
 	bool	   equ = false;
 
 	// optional label
 	label_t lbl = NULL;
+
+	// macro body
+	if (mac.defining) {
+	    if (macro_line (p) && mac.rept)
+		rept_expand (lineno);
+	    p += strlen ((char *) p);
+	    goto list;
+	}
+
+	// conditional assembly
+	if (cond.skip) {
+	    cond_skip (p, lineno, out);
+	    p += strlen ((char *) p);
+	    goto list;
+	}
 	if (isalpha (*p) || *p == '.') {
 	    bool local = false; if (*p == '.') {p++; local = true;}
 	    char   *id = tmp;
@@ -719,21 +2453,28 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 
 	    // register/find label
 	    lbl = find_label (local ? mainlbl : NULL, tmp, id - tmp);
+	    if (lbl && (lbl->flags & LABEL_LOOP))
+		pc = loop_align (pc, out, listing);
 	    if (lbl) {
 		if (pass == 0)
 		    error (lineno, "duplicated label");
 		else if ((lbl->flags & LABEL_EQU) == 0 && lbl->value != pc) {
+		    // the image already uses the old value
+		    if (out)
+			error (lineno, "label moved on last pass !");
 		    *pmore     = true;
 		    lbl->value = pc;
+		    label_moved (lbl);
 		    //eprint (-1, fmt ("label previous value %w now %w\n", lbl->value, pc));
 		    //error (lineno, "label value changed on pass 2");
 		}
 	    } else {
 		*pmore = true;
-		lbl    = add_label (local ? mainlbl : NULL, tmp, id - tmp, pc);
+		lbl    = add_label (local ? mainlbl : NULL, tmp, id - tmp, pc, lineno);
 		if (out)
 		    error (lineno, "undefined label on last pass !");
 	    }
+	    lbl->seen = pass + 1;
 
 	    // set main label
 	    if (!local) mainlbl = lbl;
@@ -745,6 +2486,18 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	// skip spaces
 	while (*p && *p <= ' ') p++;
 
+	// a label or a directive ends an unreachable run
+	if (lbl || *p == '.')
+	    unreach.dead = false;
+	if (lbl) {
+	    tail.has   = true;
+	    tail.label = label_ref (lbl);
+	}
+	if (lbl || *p == '.')
+	    tail_break (pmore);
+	if (*p == '.')
+	    tail.has = false;
+
 	// body
 	if (*p == '.') {
 	    // directive
@@ -763,18 +2516,59 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 		bytes	= vp.v - pc;
 		org	= true;
 	    } else if (!strcmp (tmp, "END")) {
-		ended	= true;
-	    } else if (!strcmp (tmp, "EQU")) {
-		vp_t vp = expr (lineno, mainlbl, false, pc, p);
-		p	= vp.p; if (!p) continue;
-		if (lbl) {
-		    lbl->value	= vp.v;
-		    lbl->flags |= LABEL_USED | LABEL_EQU;
-		    equ 	= true;
+		// an included file ends, the includer goes on
+		if (inc.depth > 1)
+		    inc.vframe[inc.depth - 1].line = srcs.v[srcidx].nline;
+		else
+		    ended = true;
+	    } else if (!strcmp (tmp, "INCLUDE")) {
+		static char name[PATH_MAX];
+		unsigned    len = 0;
+		if (*p != '"') {
+		    error (lineno, ".INCLUDE without \"file\"");
+		    continue;
+		}
+		for (++p; *p && *p != '"' && len < sizeof (name) - 1; p++)
+		    name[len++] = *p;
+		if (*p++ != '"') {
+		    error (lineno, "incomplete string");
+		    continue;
+		}
+		name[len] = 0;
+		while (*p && *p <= ' ') p++;
+		if (mac.depth) {
+		    error (lineno, ".INCLUDE in a macro or .REPT");
+		    continue;
+		}
+		if (inc.depth > MAX_INCLUDE_DEPTH) {
+		    error (lineno, ".INCLUDE nested too deep");
+		    continue;
+		}
+		unsigned i = src_include (name);
+		label_t	 g = srcs.v[i].guard[0] ? find_label (NULL, srcs.v[i].guard, strlen (srcs.v[i].guard)) : NULL;
+		if (g && (g->seen == UINT16_MAX || g->seen == pass + 1)) {
+		    // guarded and already in, no lines to lex
+		    if (out) inc.guarded++;
 		} else {
+		    if (out) inc.count++;
+		    inc.vframe[inc.depth].src  = i;
+		    inc.vframe[inc.depth].line = 0;
+		    inc.depth++;
+		}
+	    } else if (!strcmp (tmp, "EQU")) {
+		if (!lbl) {
 		    error (lineno, ".EQU without label");
 		    continue;
 		}
+		if (!lbl->equ)
+		    equ_define (lbl, mainlbl, pc, lineno, p);
+		equ_t *e = &equs.vequ[lbl->equ - 1];
+		e->pc	 = pc;
+		if ((lbl->flags & LABEL_LAZY) || !(lbl->flags & LABEL_CONST))
+		    equ_eval (lbl, pass > 0);
+		if (!e->len) continue;
+		p  += e->len;
+		equ = true;
 	    } else if (!strcmp (tmp, "ZERO") || !strcmp (tmp, "ALIGN")) {
 		bool align = tmp[0] == 'A';
 		vp_t vp = expr (lineno, mainlbl, false, pc, p);
@@ -783,7 +2577,7 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 		    unsigned mask = vp.v - 1;
 		    vp.v	  = (vp.v - (pc & mask)) & mask;
 		}
-		if (vp.v > sizeof (code)) {
+		if (vp.v > MAX_LINE) {
 		    error (lineno, ".ZERO/.ALIGN size overflow");
 		    continue;
 		}
@@ -793,6 +2587,102 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 		vp_t vp = expr (lineno, mainlbl, false, pc, p);
 		p	= vp.p; if (!p) continue;
 		space	= bytes = vp.v;
+	    } else if (!strcmp (tmp, "SECTION") || !strcmp (tmp, "HOT") || !strcmp (tmp, "COLD")) {
+		static char name[MAX_LINE];
+		unsigned    len = 0;
+		if (tmp[0] == 'S')
+		    for (; isalnum (*p) || *p == '_'; p++)
+			name[len++] = toupper (*p);
+		else
+		    len = strlen (strcpy (name, tmp[0] == 'H' ? "TEXT" : tmp));
+		if (!len) {
+		    error (lineno, ".SECTION without name");
+		    continue;
+		}
+
+		// optional origin
+		while (*p && *p <= ' ') p++;
+		bool	 fixed = *p == ',';
+		unsigned origin = 0;
+		if (fixed) {
+		    vp_t vp = expr (lineno, mainlbl, false, pc, p + 1);
+		    p	    = vp.p; if (!p) continue;
+		    origin  = vp.v;
+		}
+		pc = section_switch (lineno, name, len, fixed, origin, pc, pmore);
+	    } else if (!strcmp (tmp, "MACRO")) {
+		if (mac.depth) {
+		    error (lineno, ".MACRO inside a macro");
+		    continue;
+		}
+		macro_begin (lineno, p, pass);
+		p += strlen ((char *) p);
+	    } else if (!strcmp (tmp, "REPT")) {
+		vp_t vp = expr (lineno, mainlbl, false, pc, p);
+		p	= vp.p; if (!p) continue;
+		if (vp.v > 0xffff) {
+		    error (lineno, ".REPT count too large");
+		    continue;
+		}
+
+		// optional iteration symbol, a constant equate
+		int var = -1;
+		while (*p && *p <= ' ') p++;
+		if (*p == ',') {
+		    for (++p; *p && *p <= ' ';) p++;
+		    char *id = tmp;
+		    for (; isalnum (*p) || *p == '_'; p++)
+			*id++ = toupper (*p);
+		    if (id == tmp) {
+			error (lineno, ".REPT without symbol after ','");
+			continue;
+		    }
+		    label_t l = find_label (NULL, tmp, id - tmp);
+		    if (!l) {
+			// the table may move
+			unsigned m = mainlbl ? mainlbl - tlabel : 0;
+			l	   = add_label (NULL, tmp, id - tmp, 0, lineno);
+			mainlbl    = mainlbl ? &tlabel[m] : NULL;
+		    } else if (!(l->flags & LABEL_EQU)) {
+			error (lineno, ".REPT symbol is a label");
+			continue;
+		    }
+		    l->flags |= LABEL_USED | LABEL_EQU | LABEL_CONST;
+		    l->seen   = pass + 1;
+		    var       = l - tlabel;
+		}
+		while (*p && *p <= ' ') p++;
+		rept_begin (lineno, vp.v, var);
+	    } else if (!strcmp (tmp, "IF")) {
+		vp_t vp = expr (lineno, mainlbl, false, pc, p);
+		p	= vp.p; if (!p) continue;
+		cond_if (lineno, vp.v != 0);
+	    } else if (!strcmp (tmp, "IFDEF") || !strcmp (tmp, "IFNDEF")) {
+		char *id = tmp + 8;
+		for (; isalnum (*p) || *p == '_'; p++)
+		    *id++ = toupper (*p);
+		while (*p && *p <= ' ') p++;
+		// defined before this line on this pass, the same answer on every pass
+		label_t l = find_label (NULL, tmp + 8, id - tmp - 8);
+		if (l) l->flags |= LABEL_USED;
+		bool def  = l && (l->seen == UINT16_MAX || l->seen == pass + 1);
+		cond_if (lineno, def == (tmp[2] == 'D'));
+	    } else if (!strcmp (tmp, "ELSE")) {
+		cond_else (lineno);
+	    } else if (!strcmp (tmp, "ENDIF")) {
+		cond_endif (lineno);
+	    } else if (!strcmp (tmp, "ENDM") || !strcmp (tmp, "ENDR")) {
+		error (lineno, tmp[3] == 'M' ? ".ENDM without .MACRO" : ".ENDR without .REPT");
+		continue;
+	    } else if (!strcmp (tmp, "POOL")) {
+		if (pool.placed) {
+		    error (lineno, "duplicated .POOL");
+		    continue;
+		}
+		pool.placed = true;
+		pool.pad    = (4 - (pc & 3)) & 3;
+		bytes	    = pool.base < 0 ? 0 : pool.pad + 4 * pool.nslot;
+		lits	    = bytes != 0;
 	    } else if (!strcmp (tmp, "BYTE")) {
 		for (;;) {
 		    // skip blanks
@@ -808,7 +2698,9 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			}
 			while (*p && *p <= ' ') p++;
 		    } else {
-			vp_t vp = expr (lineno, mainlbl, !out, pc, p);
+			vp_t vp = {p, 0};
+			if (!data_literal (&vp.p, &vp.v))
+			    vp = expr (lineno, mainlbl, !out, pc, p);
 			p	= vp.p; if (!p) goto next;
 
 			code[bytes++] = vp.v;
@@ -821,7 +2713,9 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	    } else if (!strcmp (tmp, "WORD") || !strcmp (tmp, "LONG")) {
 		bool isword = tmp[0] == 'W';
 		for (;;) {
-		    vp_t vp = expr (lineno, mainlbl, !out, pc, p);
+		    vp_t vp = {p, 0};
+		    if (!data_literal (&vp.p, &vp.v))
+			vp = expr (lineno, mainlbl, !out, pc, p);
 		    p	    = vp.p; if (!p) goto next;
 
 		    if (!isword) {
@@ -850,10 +2744,44 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	    // find opcode
 	    int op = op_find (tmp);
 	    if (op < 0) {
+		int m = macro_find (tmp, id - (uint8_t *) tmp - 1);
+		if (m >= 0) {
+		    macro_expand (lineno, m, p);
+		    p += strlen ((char *) p);
+		    goto list;
+		}
 		error (lineno, "unknown opcode");
 		continue;
 	    }
 
+	    // clean statement, encoding of the previous pass
+	    bool	transfer = op == OP_BRA || op == OP_JMP || op == OP_RET || op == OP_ERET || op == OP_SRET || op == OP_IRET;
+	    uint8_t    *s	 = stmt_state (st);
+	    uint32_t	hash	 = 0;
+	    if (reeval.on && pass && !out) {
+		// the same text under another main label names other local labels
+		cache_t *c = reeval_cache (st);
+		hash	   = line_hash (buffer) ^ (mainlbl ? label_ref (mainlbl) * 2654435761u : 0);
+		if ((*s & (STMT_CACHED | STMT_DIRTY)) == STMT_CACHED && c->hash == hash && (!c->relative || c->pc == pc)) {
+		    memcpy (code, c->code, c->bytes);
+		    bytes = c->bytes;
+		    if (unreach.dead)
+			unreach.run = true;
+		    else if (transfer)
+			unreach.dead = true, unreach.run = false;
+		    reeval.reused++;
+		    p += strlen ((char *) p);
+		    goto list;
+		}
+		// a .REPT count that changed shifts statement numbers, another line sits here now
+		if ((*s & STMT_CACHED) && c->hash != hash)
+		    *s &= ~STMT_DEPS;
+		reeval.rec = !(*s & STMT_DEPS);
+		reeval.st  = st;
+	    }
+	    reeval.evaluated++;
+	    unsigned pcs = exprpc;
+
 	    // arguments
 	    struct arg_t va[3];
 	    int 	 na = 0;
@@ -880,10 +2808,12 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 
 		    int rno = reg_find (tmp);
 		    if (rno < 0) {
+			unsigned el = exprlabels, ep = exprpc;
 			vp_t	vp = expr (lineno, mainlbl, out ? false : true, pc, pp);
 			p	   = vp.p; if (!p) goto next;
 			va[na].k   = N;
 			va[na].val = vp.v;
+			arg_text (&va[na], pp, p, el, ep);
 		    } else {
 			va[na].k   = R;
 			va[na].rno = reg_find (tmp);
@@ -920,10 +2850,13 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			goto next;
 		    }
 		} else if (*p == ':' || *p == '.' || *p == '$' || *p == '\'' || *p == '-' || isdigit (*p)) {
+		    unsigned el = exprlabels, ep = exprpc;
+		    uint8_t *pp = p;
 		    vp_t    vp = expr (lineno, mainlbl, !out, pc, p);
 		    p	       = vp.p; if (!p) goto next;
 		    va[na].k   = N;
 		    va[na].val = vp.v;
+		    arg_text (&va[na], pp, p, el, ep);
 		} else
 		    break;
 
@@ -936,9 +2869,15 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 
 	    // skip spaces
 	    while (*p && *p <= ' ') p++;
+	    if (reeval.rec) {
+		*stmt_state (st) |= STMT_DEPS;
+		reeval.rec	  = false;
+	    }
 
 	    // match template
+	    phase (PH_MATCH);
 	    tentry_t te = match (op, na, va);
+	    phase (PH_ENCODE);
 	    if (!te) {
 		error (lineno, "unknown combination of opcode and args");
 		//printf ("opcode value %x template [%s]\n", v, tmp);
@@ -947,7 +2886,11 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 		// emit
 		int	 k = te->kind;
 		unsigned w = te->word;
+		if (tail.on && tail_insn (st, op, lbl, va, &w, &k, out, pmore))
+		    k = '-';
 		again: switch (k) {
+		    case '-':	// dropped by tail call fusion
+			break;
 		    case 'N':	// direct opcode
 			code[bytes++] = w >> 8;
 			code[bytes++] = w;
@@ -967,6 +2910,18 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			k	  = 'A';
 			goto again;
 		    case 'A':	// 2 regs + imm
+			if (peep.on && !(w & 0xf0)) {
+			    // once kept long from the second pass on, stay long so sizes converge,
+			    // li gets here as an ori with its source preset and is left alone
+			    uint8_t *s = stmt_state (st);
+			    int      n = *s & STMT_LONG ? -1 : peephole_alu (w, va[0].rno, va[1].rno, va[2].val, code + bytes);
+			    if (n >= 0) {
+				peephole_saved (out, 4, n);
+				bytes += n;
+				break;
+			    }
+			    if (pass) *s |= STMT_LONG;
+			}
 			code[bytes++] = (w >> 8) | va[0].rno;
 			code[bytes++] = (w >> 0) | (va[1].rno << 4);
 			code[bytes++] = va[2].val >> 8;
@@ -988,23 +2943,54 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			k	  = 'A';
 			goto again;
 		    case 'B': { // branch
+			    int off = ((int) va[0].val - ((int) pc + 4)) / 2;
+			    if (loops.size && va[0].val <= pc)
+				loop_head (va[0].lbl, va[0].val, pmore);
+
+			    // relaxation, out of range branches take the long form for good
+			    uint8_t *s = stmt_state (st);
+			    if (off >= 32768 || off < -32768) {
+				if (!(*s & STMT_LONG)) *pmore = true;
+				*s |= STMT_LONG;
+			    }
+			    if (out && branches.on)
+				branch_note (mainlbl, lineno, (int) va[0].val - ((int) pc + 4), *s & STMT_LONG);
+			    if (*s & STMT_LONG) {
+				if (out) relaxed++;
+				if (w != 0x2ff0) {
+				    // inverted condition over a jmp
+				    w = branch_invert (w);
+				    code[bytes++] = w >> 8;
+				    code[bytes++] = w >> 0;
+				    code[bytes++] = 0;
+				    code[bytes++] = 3;
+				}
+				// jmp
+				code[bytes++] = 0x0f;
+				code[bytes++] = 0xfc;
+				off = ((int) va[0].val - ((int) (pc + bytes) + 4)) / 2;
+				code[bytes++] = off >> 24;
+				code[bytes++] = off >> 16;
+				code[bytes++] = off >> 8;
+				code[bytes++] = off;
+				break;
+			    }
 			    code[bytes++] = w >> 8;
 			    code[bytes++] = w >> 0;
-			    int off = ((int) va[0].val - ((int) pc + 4)) / 2;
 			    code[bytes++] = off >> 8;
 			    code[bytes++] = off;
-			    if (out && (off >= 32768 || off < -32768))
-				error (lineno, "branch out of range");
 			} break;
 		    case 'b':	// conditional branch
 			w	 |= (va[0].rno << 8) | (va[1].rno << 4);
 			k	  = 'B';
 			va[0].val = va[2].val;
+			va[0].lbl = va[2].lbl;
 			goto again;
 		    case '!':	// conditional branch sugar syntax
 			w	 |= (va[0].rno << 8);
 			k	  = 'B';
 			va[0].val = va[1].val;
+			va[0].lbl = va[1].lbl;
 			goto again;
 		    case 'M':	// memory access
 			code[bytes++] = (w >> 8) | va[0].rno;
@@ -1022,6 +3008,20 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			k	  = 'M';
 			goto again;
 		    case 'J': { // jmp/jal
+			    if (peep.on && w == 0x0ffc) {
+				// jmp in branch range: bra, long form is sticky so sizes converge
+				uint8_t *s = stmt_state (st);
+				int    off = ((int) va[0].val - ((int) pc + 4)) / 2;
+				if (off >= 32768 || off < -32768) {
+				    if (!(*s & STMT_LONG)) *pmore = true;
+				    *s |= STMT_LONG;
+				} else if (!(*s & STMT_LONG)) {
+				    peephole_saved (out, 6, 4);
+				    w = 0x2ff0;
+				    k = 'B';
+				    goto again;
+				}
+			    }
 			    code[bytes++] = w >> 8;
 			    code[bytes++] = w >> 0;
 			    int off = ((int) va[0].val - ((int) pc + 6)) / 2;
@@ -1031,6 +3031,16 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			    code[bytes++] = off;
 			} break;
 		    case 'L': { // lea
+			    int      v = va[1].val;
+			    uint8_t *s = stmt_state (st);
+			    if (peep.on && !(*s & STMT_LONG) && v >= -32768 && v <= 32767) {
+				// absolute target fits an immediate: li
+				peephole_saved (out, 6, v == 0 || v == 1 ? 2 : 4);
+				w = 0x0f0c;
+				k = 'I';
+				goto again;
+			    }
+			    if (peep.on && pass) *s |= STMT_LONG;
 			    code[bytes++] = w >> 8;
 			    code[bytes++] = w >> 0 | (va[0].rno << 4);
 			    int off = ((int) va[1].val - ((int) pc + 6));
@@ -1053,7 +3063,8 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			}
 			goto again;
 		    case 'I': { // li
-			    int n = va[1].val;
+			    int     n = va[1].val;
+			    lit_t  *l;
 			    if (n == 0) {
 				// and r, zero, sp
 				code[bytes++] = 0x80 | va[0].rno;
@@ -1069,6 +3080,14 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 				va[2].val = va[1].val;
 				k	  = 'A';
 				goto again;
+			    } else if (pool.base >= 0 && (l = pool_use (mainlbl, &va[1], n)) && l->slot >= 0) {
+				// ld4i r, [base + offset]
+				unsigned off  = pool.pad + 4 * l->slot;
+				code[bytes++] = 0x10 | va[0].rno;
+				code[bytes++] = 0x05 | (pool.base << 4);
+				code[bytes++] = off >> 8;
+				code[bytes++] = off;
+				if (out) pool.loads++;
 			    } else {
 				code[bytes++] = w >> 8;
 				code[bytes++] = w >> 0 | (va[0].rno << 4);
@@ -1111,16 +3130,40 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 			break;
 		}
 	    }
+
+	    // unreachable code
+	    if (unreach.dead)
+		bytes = unreachable (lineno, bytes, out);
+	    else if (transfer) {
+		unreach.dead = true;
+		unreach.run  = false;
+	    }
+
+	    // cache the encoding for the next pass
+	    if (hash && bytes <= sizeof (reeval.vcache[0].code)) {
+		cache_t *c  = reeval_cache (st);
+		c->pc	    = pc;
+		c->hash     = hash;
+		c->bytes    = bytes;
+		c->relative = strchr ("Bb!JL", te->kind) || exprpc != pcs;
+		memcpy (c->code, code, bytes);
+		s	    = stmt_state (st);
+		*s	    = (*s & ~STMT_DIRTY) | STMT_CACHED;
+	    }
 	}
 
 	// print line
+	list:
 	if (listing) {
+	    phase (PH_LIST);
 	    unsigned count = org ? 0 : bytes;
 	    oprint (-1, fmt ("%w ", pc));
 	    if (lbl && equ)
 		oprint (-1, fmt ("= %w.%w ", lbl->value >> 16, lbl->value));
 	    else if (space)
 		oprint (-1, fmt ("? %w %5", space, space));
+	    else if (lits)
+		oprint (-1, fmt ("P %w %5", pool.nslot, pool.nslot));
 	    else {
 		for (unsigned i = 0; i < 6; i++)
 		    if (i < count) oprint (-1, fmt ("%b", code[i]));
@@ -1128,7 +3171,12 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	    }
 	    oprint (-1, fmt (" %5\t%s", lineno, buffer));
 
-	    if (count > 6 && !space)
+	    if (lits)
+		for (unsigned i = 0; i < pool.nslot; i++) {
+		    uint32_t v = pool.vlit[pool.vslot[i]].value;
+		    oprint (-1, fmt ("%w %w%w\n", pc + pool.pad + 4 * i, v >> 16, v));
+		}
+	    else if (count > 6 && !space)
 		for (unsigned i = 6; i < count;) {
 		    oprint (-1, fmt ("%w ", pc + i));
 		    for (unsigned n = 0; n < 6; ++n, i++)
@@ -1139,11 +3187,21 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	}
 
 	// output
-	if (out && !org && bytes && !space)
+	phase (PH_EMIT);
+	if (out && lits) {
+	    for (unsigned i = 0; i < pool.pad; i++)
+		emit (pc + i, 0);
+	    for (unsigned i = 0; i < pool.nslot; i++) {
+		uint32_t v = pool.vlit[pool.vslot[i]].value;
+		for (unsigned n = 0; n < 4; n++)
+		    emit (pc + pool.pad + 4 * i + n, v >> (24 - 8 * n));
+	    }
+	} else if (out && !org && bytes && !space)
 	    for (unsigned i = 0; i < bytes; i++)
 		emit (pc + i, code[i]);
 
 	// update counter
+	if (bytes && !org) section_use (pc, bytes);
 	pc += bytes;
 
 	// discard comments and empty lines
@@ -1157,13 +3215,306 @@ static unsigned assemble (int fd, unsigned pass, bool out, unsigned pc, bool lis
 	// next
 	next: ;
     }
+    if (cond.depth) {
+	error (lineno - 1, ".IF without .ENDIF");
+	cond.depth = cond.skip = 0;
+    }
+    if (mac.defining) {
+	error (lineno - 1, mac.rept ? ".REPT without .ENDR" : ".MACRO without .ENDM");
+	mac.defining = false;
+    }
+    tail_break (pmore);
+    phase (PH_IDLE);
     return pc;
 }
 
+/*
+ * stats report
+ */
+static struct {uint64_t wall, cpu, lines, bytes, mem;} vpass[MAX_PASSES];
+static unsigned npass;
+static uint64_t wall0, cpu0;
+static bool	show_stats;
+
+static uint64_t per_second (uint64_t n, uint64_t ns) {
+    return ns ? (uint64_t) ((double) n * 1e9 / ns) : 0;
+}
+
+static void stats_pass (unsigned pass, uint64_t wall, uint64_t cpu, uint64_t lines, uint64_t bytes) {
+    if (pass < MAX_PASSES) {
+	vpass[pass].wall  = wall;
+	vpass[pass].cpu   = cpu;
+	vpass[pass].lines = lines;
+	vpass[pass].bytes = bytes;
+	vpass[pass].mem   = mem.pass_top;
+    }
+    if (show_stats)
+	eprint (-1, fmt ("eonasm stats: pass %5  wall %U us  cpu %U us  %U lines  %U bytes  mem peak %U bytes\n",
+	    pass, (unsigned long long) wall / 1000, (unsigned long long) cpu / 1000,
+	    (unsigned long long) lines, (unsigned long long) bytes, (unsigned long long) mem.pass_top
+	    ));
+}
+
+static void stats_report (uint64_t wall, uint64_t cpu) {
+    eprint (-1, fmt ("eonasm stats: total   wall %U us  cpu %U us  %U lines/s  %U bytes/s\n",
+	(unsigned long long) wall / 1000, (unsigned long long) cpu / 1000,
+	(unsigned long long) per_second (stats.lines, wall),
+	(unsigned long long) per_second (stats.bytes, wall)
+	));
+    for (unsigned i = PH_IDLE + 1; i < PH_MAX; i++)
+	eprint (-1, fmt ("eonasm stats: phase %s\t%U us\n", phname[i], (unsigned long long) stats.ns[i] / 1000));
+    for (unsigned i = 0; i < MEM_MAX; i++)
+	eprint (-1, fmt ("eonasm stats: memory %s\t%U bytes, peak %U bytes\n", memname[i],
+	    (unsigned long long) mem.cur[i], (unsigned long long) mem.peak[i]));
+    eprint (-1, fmt ("eonasm stats: reeval instructions\t%U parsed, %U reused\n",
+	(unsigned long long) reeval.evaluated, (unsigned long long) reeval.reused));
+    struct rusage ru;
+    getrusage (RUSAGE_SELF, &ru);
+    eprint (-1, fmt ("eonasm stats: memory total\t%U bytes, peak %U bytes, max rss %U KB\n",
+	(unsigned long long) mem.total, (unsigned long long) mem.top, (unsigned long long) ru.ru_maxrss));
+#ifdef COUNTERS
+    uint64_t *vc = (uint64_t *) &counters;
+    for (unsigned i = 0; i < sizeof (counters) / sizeof (vc[0]); i++)
+	eprint (-1, fmt ("eonasm stats: count %s\t%U\n", counter_name[i], (unsigned long long) vc[i]));
+#else
+    eprint (-1, "eonasm stats: hot path counters not compiled (make counters)\n");
+#endif
+}
+
+/*
+ * trace spans
+ */
+static void trace_file (unsigned pass, uint64_t ts, const uint64_t *ns, uint64_t lines) {
+    char args[MAX_LINE * 2];
+    strcpy (args, fmt ("\"pass\": %U, \"lines\": %U", (unsigned long long) pass, (unsigned long long) (stats.lines - lines)));
+    for (unsigned i = PH_IDLE + 1; i < PH_MAX; i++)
+	strcat (args, fmt (", \"%s_us\": %U", phname[i], (unsigned long long) (stats.ns[i] - ns[i]) / 1000));
+    trace_event (source, "file", ts, clock_ns (CLOCK_MONOTONIC) - ts, args);
+}
+
+static void trace_pass (unsigned pass, bool last, uint64_t ts) {
+    char name[32];
+    strcpy (name, fmt ("pass %U%s", (unsigned long long) pass, last ? " (last)" : ""));
+    trace_event (name, "pass", ts, clock_ns (CLOCK_MONOTONIC) - ts, NULL);
+}
+
+/*
+ * json report
+ */
+static const char  *json_path;
+static int	    jfd;
+static char	  **infiles;
+static int	    ninfiles;
+
+#define jprint(l,s) _print (jfd, l, s)
+
+static void json_string (const char *z, unsigned len) {
+    char  buf[MAX_LINE];
+    char *b = buf;
+    *b++ = '"';
+    for (unsigned i = 0; i < len && z[i]; i++) {
+	if (b >= buf + sizeof (buf) - 8) {
+	    jprint (b - buf, buf);
+	    b = buf;
+	}
+	unsigned c = (uint8_t) z[i];
+	if (c == '"' || c == '\\') {
+	    *b++ = '\\';
+	    *b++ = c;
+	} else if (c < ' ') {
+	    memcpy (b, "\\u00", 4);
+	    b	 += 4;
+	    *b++  = hdigit[c >> 4];
+	    *b++  = hdigit[c & 15];
+	} else
+	    *b++ = c;
+    }
+    *b++ = '"';
+    jprint (b - buf, buf);
+}
+
+static void json_diag (const char *key, diag_t *v, unsigned n) {
+    jprint (-1, fmt ("  \"%s\": [", key));
+    for (unsigned i = 0; i < n; i++) {
+	jprint (-1, i ? ",\n    {\"source\": " : "\n    {\"source\": ");
+	json_string (v[i].source, -1);
+	jprint (-1, fmt (", \"line\": %U, \"message\": ", (unsigned long long) v[i].lineno));
+	json_string (v[i].msg, -1);
+	if (v[i].sym) {
+	    jprint (-1, ", \"symbol\": ");
+	    json_string (v[i].sym, v[i].symlen);
+	}
+	jprint (1, "}");
+    }
+    jprint (-1, n ? "\n  ],\n" : "],\n");
+}
+
+static void json_report (void) {
+    jfd = open (json_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (jfd < 0) {
+	eprint (-1, fmt ("eonasm: can not create json report [%s]: %m\n", json_path));
+	return;
+    }
+
+    uint64_t wall = clock_ns (CLOCK_MONOTONIC) - wall0;
+    uint64_t cpu  = clock_ns (CLOCK_PROCESS_CPUTIME_ID) - cpu0;
+    struct rusage ru;
+    getrusage (RUSAGE_SELF, &ru);
+
+    // header
+    jprint (-1, "{\n  \"version\": \"" VERSION "\",\n  \"sources\": [");
+    for (int i = 0; i < ninfiles; i++) {
+	if (i) jprint (2, ", ");
+	json_string (infiles[i], -1);
+    }
+    jprint (-1, fmt ("],\n  \"passes\": %U,\n  \"ok\": %s,\n", (unsigned long long) npass, errcount ? "false" : "true"));
+
+    // timings
+    jprint (-1, fmt ("  \"timing\": {\n    \"wall_us\": %U,\n    \"cpu_us\": %U,\n",
+	(unsigned long long) wall / 1000, (unsigned long long) cpu / 1000));
+    jprint (-1, fmt ("    \"lines\": %U,\n    \"bytes\": %U,\n    \"lines_per_sec\": %U,\n",
+	(unsigned long long) stats.lines, (unsigned long long) stats.bytes,
+	(unsigned long long) per_second (stats.lines, wall)));
+    jprint (-1, "    \"phases_us\": {");
+    for (unsigned i = PH_IDLE + 1; i < PH_MAX; i++)
+	jprint (-1, fmt ("%s\"%s\": %U", i > PH_IDLE + 1 ? ", " : "", phname[i], (unsigned long long) stats.ns[i] / 1000));
+    jprint (-1, "},\n    \"per_pass\": [");
+    for (unsigned i = 0; i < npass && i < MAX_PASSES; i++)
+	jprint (-1, fmt ("%s\n      {\"pass\": %U, \"wall_us\": %U, \"cpu_us\": %U, \"lines\": %U, \"bytes\": %U, \"mem_peak\": %U}",
+	    i ? "," : "", (unsigned long long) i,
+	    (unsigned long long) vpass[i].wall / 1000, (unsigned long long) vpass[i].cpu / 1000,
+	    (unsigned long long) vpass[i].lines, (unsigned long long) vpass[i].bytes,
+	    (unsigned long long) vpass[i].mem));
+    jprint (-1, "\n    ]\n  },\n");
+
+    // symbols
+    jprint (-1, fmt ("  \"symbols\": {\"global\": %U, \"local\": %U, \"capacity\": %U},\n",
+	(unsigned long long) nlabel, (unsigned long long) nlocal, (unsigned long long) (maxlabel + maxlocal)));
+
+    // image
+    jprint (-1, fmt ("  \"image\": {\n    \"bytes\": %U,\n    \"regions\": %U,\n    \"region\": [",
+	(unsigned long long) imagesize, (unsigned long long) nregion));
+    for (unsigned i = 0; i < nregion && i < MAX_REGIONS; i++)
+	jprint (-1, fmt ("%s\n      {\"start\": %U, \"size\": %U}", i ? "," : "",
+	    (unsigned long long) vregion[i].at, (unsigned long long) vregion[i].size));
+    jprint (-1, "\n    ]\n  },\n");
+
+    // optimizer
+    if (peep.on)
+	jprint (-1, fmt ("  \"peephole\": {\"bytes_saved\": %U, \"rewrites\": %U},\n",
+	    (unsigned long long) peep.bytes, (unsigned long long) peep.rewrites));
+    jprint (-1, "  \"sections\": [");
+    for (unsigned i = 0; i < nsect; i++) {
+	jprint (-1, i ? ", {\"name\": " : "{\"name\": ");
+	json_string (vsect[i].name, vsect[i].len);
+	jprint (-1, fmt (", \"origin\": %U, \"bytes\": %U}", (unsigned long long) vsect[i].origin,
+	    (unsigned long long) (vsect[i].hi > vsect[i].lo ? vsect[i].hi - vsect[i].lo : 0)));
+    }
+    jprint (-1, fmt ("],\n  \"relaxed_branches\": %U,\n", (unsigned long long) relaxed));
+    jprint (-1, fmt ("  \"skipped_lines\": %U,\n", (unsigned long long) cond.lines));
+    jprint (-1, fmt ("  \"reeval\": {\"parsed\": %U, \"reused\": %U, \"edges\": %U},\n",
+	(unsigned long long) reeval.evaluated, (unsigned long long) reeval.reused, (unsigned long long) reeval.ndep));
+    jprint (-1, fmt ("  \"includes\": {\"files\": %U, \"bytes_read\": %U, \"entered\": %U, \"guarded\": %U},\n",
+	(unsigned long long) srcs.n, (unsigned long long) srcs.bytes, (unsigned long long) inc.count,
+	(unsigned long long) inc.guarded));
+    jprint (-1, fmt ("  \"snapshot\": {\"loaded\": %U, \"exported\": %U},\n",
+	(unsigned long long) syms.loaded, (unsigned long long) syms.exported));
+    jprint (-1, fmt ("  \"equates\": {\"defined\": %U, \"deferred\": %U},\n",
+	(unsigned long long) equs.nequ, (unsigned long long) equs.deferred));
+    jprint (-1, fmt ("  \"unreachable\": {\"runs\": %U, \"instructions\": %U, \"bytes\": %U, \"stripped\": %s},\n",
+	(unsigned long long) unreach.runs, (unsigned long long) unreach.insns, (unsigned long long) unreach.bytes,
+	unreach.strip ? "true" : "false"));
+    jprint (-1, fmt ("  \"macros\": {\"defined\": %U, \"expansions\": %U, \"segments\": %U},\n",
+	(unsigned long long) mac.nmacro, (unsigned long long) mac.count, (unsigned long long) mac.nseg));
+    if (tail.on)
+	jprint (-1, fmt ("  \"tail\": {\"fused\": %U, \"threaded\": %U, \"bytes\": %U, \"cycles\": %U},\n",
+	    (unsigned long long) tail.fused, (unsigned long long) tail.threaded, (unsigned long long) tail.bytes,
+	    (unsigned long long) (tail.fused + tail.hops) * TRANSFER_CYCLES));
+    if (branches.on) {
+	jprint (-1, fmt ("  \"branches\": {\"margin\": %U, \"near\": %U, \"histogram\": {",
+	    (unsigned long long) branches.margin, (unsigned long long) branches.near));
+	for (unsigned b = 0; b < BRANCH_BUCKETS; b++)
+	    jprint (-1, fmt ("%s\"%s\": %U", b ? ", " : "", bucketname[b], (unsigned long long) branches.count[b]));
+	jprint (-1, "}},\n");
+    }
+    if (loops.size)
+	jprint (-1, fmt ("  \"loop_align\": {\"size\": %U, \"heads\": %U, \"bytes\": %U},\n",
+	    (unsigned long long) loops.size, (unsigned long long) loops.heads, (unsigned long long) loops.bytes));
+    if (pool.base >= 0)
+	jprint (-1, fmt ("  \"pool\": {\"entries\": %U, \"loads\": %U, \"literals\": %U},\n",
+	    (unsigned long long) pool.nslot, (unsigned long long) pool.loads, (unsigned long long) pool.nlit));
+
+    // diagnostics
+    json_diag ("errors",   vdiag, errcount);
+    json_diag ("warnings", vwarn, nwarn);
+
+    // counters
+#ifdef COUNTERS
+    uint64_t *vc = (uint64_t *) &counters;
+    jprint (-1, "  \"counters\": {");
+    for (unsigned i = 0; i < sizeof (counters) / sizeof (vc[0]); i++) {
+	jprint (-1, i ? ", " : "");
+	json_string (counter_name[i], -1);
+	jprint (-1, fmt (": %U", (unsigned long long) vc[i]));
+    }
+    jprint (-1, "},\n");
+#endif
+
+    // memory
+    jprint (-1, "  \"memory\": {");
+    for (unsigned i = 0; i < MEM_MAX; i++)
+	jprint (-1, fmt ("\n    \"%s\": {\"current\": %U, \"peak\": %U},", memname[i],
+	    (unsigned long long) mem.cur[i], (unsigned long long) mem.peak[i]));
+    jprint (-1, fmt ("\n    \"total\": {\"current\": %U, \"peak\": %U}\n  },\n",
+	(unsigned long long) mem.total, (unsigned long long) mem.top));
+    jprint (-1, fmt ("  \"peak_rss_kb\": %U\n}\n", (unsigned long long) ru.ru_maxrss));
+    close (jfd);
+}
+
+/*
+ * state reset, so main can run several times in one process (golden corpus runner)
+ */
+static void reset (void) {
+    errcount = nwarn = 0;
+    pending  = basepc = outpc = outhi = 0;
+    nregion  = imagesize = 0;
+    nlabel   = nlocal = 0;
+    npass    = 0;
+    memset (&stats, 0, sizeof (stats));
+#ifdef COUNTERS
+    memset (&counters, 0, sizeof (counters));
+#endif
+    show_stats = false;
+    json_path  = NULL;
+    peep.on    = false;
+    peep.bytes = peep.rewrites = 0;
+    pool_reset ();
+    memset (&loops, 0, sizeof (loops));
+    nsect   = 0;
+    relaxed = 0;
+    branch_reset ();
+    equ_reset ();
+    reeval_reset ();
+    src_reset ();
+    memset (&syms, 0, sizeof (syms));
+    memset (&tail, 0, sizeof (tail));
+    mac.nmacro = mac.nseg = mac.ntext = 0;
+    mac.defining = false;
+    memset (&cond, 0, sizeof (cond));
+    memset (&unreach, 0, sizeof (unreach));
+    if (vstmt) memset (vstmt, 0, maxstmt);
+
+    // tables kept for the next run stay accounted, the high-water marks start over
+    memcpy (mem.peak, mem.cur, sizeof (mem.peak));
+    mem.top = mem.pass_top = mem.total;
+}
+
 /*
  * entry point
  */
 int main (int argc, char **argv) {
+    reset ();
+
     // options
     bool listing = false;
     bool unused  = false;
@@ -1178,7 +3529,90 @@ int main (int argc, char **argv) {
 	    unused = true;
 	else if (!strcmp (op, "-v"))
 	    verbose = true;
-	else {
+	else if (!strcmp (op, "-O"))
+	    peep.on = true;
+	else if (!strcmp (op, "-T"))
+	    tail.on = true;
+	else if (!strcmp (op, "-A") && argc > 1) {
+	    loops.size = atoi (*++argv);
+	    --argc;
+	    if (loops.size < 4 || loops.size > 256 || (loops.size & (loops.size - 1))) {
+		eprint (-1, fmt ("eonasm: bad loop alignment [%s]\n", *argv));
+		exit   (1);
+	    }
+	} else if (!strcmp (op, "-S") && argc > 1) {
+	    // NAME=origin, origin in c or $hex notation
+	    const char *arg = *++argv;
+	    const char *eq  = strchr (arg, '=');
+	    char name[MAX_CHAR_LABEL];
+	    unsigned len = eq ? eq - arg : 0;
+	    for (unsigned i = 0; i < len && i < sizeof (name); i++)
+		name[i] = toupper (arg[i]);
+	    --argc;
+	    section_begin ();
+	    int i = eq && eq[1] && len < sizeof (name) ? section_find (name, len) : -1;
+	    if (i < 0) {
+		eprint (-1, fmt ("eonasm: bad section [%s]\n", arg));
+		exit   (1);
+	    }
+	    vsect[i].fixed  = true;
+	    vsect[i].origin = eq[1] == '$' ? strtoul (eq + 2, NULL, 16) : strtoul (eq + 1, NULL, 0);
+	} else if (!strcmp (op, "-D") && argc > 1) {
+	    // NAME[=value], value in c or $hex notation, 1 by default
+	    const char *arg = *++argv;
+	    const char *eq  = strchr (arg, '=');
+	    unsigned	len = eq ? (unsigned) (eq - arg) : strlen (arg);
+	    char name[MAX_CHAR_LABEL];
+	    for (unsigned i = 0; i < len && i < sizeof (name); i++)
+		name[i] = toupper (arg[i]);
+	    --argc;
+	    if (!len || len > sizeof (name) || !isalpha (*arg) || find_label (NULL, name, len)) {
+		eprint (-1, fmt ("eonasm: bad define [%s]\n", arg));
+		exit   (1);
+	    }
+	    label_t l = add_label (NULL, name, len, 1, 0);
+	    l->flags |= LABEL_USED | LABEL_EQU | LABEL_CONST;
+	    l->seen   = UINT16_MAX;
+	    if (eq) l->value = eq[1] == '$' ? strtoul (eq + 2, NULL, 16) : strtoul (eq + 1, NULL, 0);
+	} else if (!strcmp (op, "-P") && argc > 1) {
+	    char reg[8] = {0};
+	    for (unsigned i = 0; i < sizeof (reg) - 1 && argv[1][i]; i++)
+		reg[i] = toupper (argv[1][i]);
+	    pool.base = reg_find (reg);
+	    if (pool.base < 0 || pool.base == 15) {
+		eprint (-1, fmt ("eonasm: bad literal pool base register [%s]\n", argv[1]));
+		exit   (1);
+	    }
+	    ++argv;
+	    --argc;
+	}
+	else if (!strcmp (op, "--branches") && argc > 1) {
+	    branches.on     = true;
+	    branches.margin = atoi (*++argv);
+	    --argc;
+	} else if (!strcmp (op, "--unreachable"))
+	    unreach.report = true;
+	else if (!strcmp (op, "--strip-unreachable"))
+	    unreach.report = unreach.strip = true;
+	else if (!strcmp (op, "--symbols") && argc > 1) {
+	    sym_load (*++argv);
+	    --argc;
+	} else if (!strcmp (op, "--export-symbols") && argc > 1) {
+	    syms.export = *++argv;
+	    --argc;
+	} else if (!strcmp (op, "--no-reuse"))
+	    reeval.on = false;
+	else if (!strcmp (op, "--stats"))
+	    stats.on = show_stats = true;
+	else if (!strcmp (op, "--trace") && argc > 1) {
+	    stats.on = true;
+	    trace_to (*++argv);
+	    --argc;
+	} else if (!strcmp (op, "--json") && argc > 1) {
+	    stats.on  = true;
+	    json_path = *++argv;
+	    --argc;
+	} else {
 	    eprint (-1, fmt ("eonasm: unknown option [%s]\n", op));
 	    exit   (1);
 	}
@@ -1193,38 +3627,87 @@ int main (int argc, char **argv) {
 	    "\t-l\tlisting\n"
 	    "\t-u\tshow unused labels\n"
 	    "\t-v\tverbose assembly\n"
+	    "\t-O\tpeephole optimizer, shortest equivalent encodings\n"
+	    "\t-T\ttail call fusion (jal X; ret -> jmp X) and branch threading\n"
+	    "\t-D name[=value]\tdefine a constant symbol for .IF (value 1 by default)\n"
+	    "\t-P reg\tliteral pool at .POOL for wide li, reg holds its address\n"
+	    "\t-A size\talign loop heads (backward branch targets) with nop\n"
+	    "\t-S name=origin\tplace .SECTION name at origin\n"
+	    "\t--branches margin\tbranch distances per routine, warn within margin bytes of the limit\n"
+	    "\t--unreachable\treport instructions after bra/jmp/ret/eret/sret/iret before a label\n"
+	    "\t--strip-unreachable\treport and drop them\n"
+	    "\t--symbols file\tpredefine the symbols of a snapshot\n"
+	    "\t--export-symbols file\twrite the constant equates as a snapshot\n"
+	    "\t--no-reuse\tparse every instruction on every pass\n"
+	    "\t--stats\tper pass/phase timings and hot path counters\n"
+	    "\t--json file\twrite a json build report\n"
+	    "\t--trace file\twrite a chrome trace of the assembly pipeline\n"
 	    );
 	exit (1);
     }
 
+    // json report is also written on fatal exits
+    infiles  = argv + 1;
+    ninfiles = argc - 1;
+    if (json_path) atexit (json_report);
+
     // process infiles
     unsigned pass = 0;
     bool  another = true;
     bool  last	  = false;
+    // pooled literals and threaded branches change encodings without moving labels
+    if (pool.base >= 0 || tail.on) reeval.on = false;
+
+    wall0 = clock_ns (CLOCK_MONOTONIC);
+    cpu0  = clock_ns (CLOCK_PROCESS_CPUTIME_ID);
+    t0	  = wall0;
     for (; !errcount && another; ++pass) {
 	// verbose
 	if (verbose) eprint (-1, fmt ("\tbegin pass %5%s\n", pass, last ? " (last)" : ""));
 
+	// pass stats
+	uint64_t pwall	= stats.on ? clock_ns (CLOCK_MONOTONIC) : 0;
+	uint64_t pcpu	= stats.on ? clock_ns (CLOCK_PROCESS_CPUTIME_ID) : 0;
+	uint64_t plines = stats.lines;
+	uint64_t pbytes = stats.bytes;
+	npass		= pass + 1;
+	mem.pass_top	= mem.total;
+
 	// output file
 	if (pass) output_to (argv[0]);
 
 	// assemble
-	unsigned pc = 0;
+	unsigned pc = section_begin ();
 	bool   more = false;
+	stmt	    = 0;
+	pool.placed = false;
+	mac.count   = 0;
+	cond.lines  = 0;
 	for (int i = 1; i < argc; ++i) {
-	    source = argv[i];
-	    int fd = open (source, O_RDONLY);
-	    if (fd < 0) {
-		eprint (-1, fmt ("error opening [%s]: %m\n", source));
-		exit   (1);
-	    }
+	    unsigned src = src_load (argv[i]);
+	    source	 = srcs.v[src].name;
+	    srcidx	 = src;
 	    if (last && listing) oprint (-1, fmt ("####################### %s\n", source));
-	    pc = assemble (fd, pass, last, pc, last ? listing : false, &more);
-	    close (fd);
+	    uint64_t fts    = tfd >= 0 ? clock_ns (CLOCK_MONOTONIC) : 0;
+	    uint64_t flines = stats.lines;
+	    uint64_t fns[PH_MAX];
+	    memcpy (fns, stats.ns, sizeof (fns));
+	    pc = assemble (src, pass, last, pc, last ? listing : false, &more);
+	    if (tfd >= 0) trace_file (pass, fts, fns, flines);
 	}
 
 	// done
+	if (pass == 0) equ_resolve ();
+	section_end (pc, &more);
+	if (last) section_check ();
 	if (last) emit_done ();
+	if (tfd >= 0) trace_pass (pass, last, pwall);
+	if (stats.on)
+	    stats_pass (pass, clock_ns (CLOCK_MONOTONIC) - pwall, clock_ns (CLOCK_PROCESS_CPUTIME_ID) - pcpu,
+			stats.lines - plines, stats.bytes - pbytes);
+
+	// literal pool layout for the next pass
+	if (pool.base >= 0 && !last) pool_pass (&more);
 
 	// flags logic
 	if (last)
@@ -1236,8 +3719,16 @@ int main (int argc, char **argv) {
     // stats
     if (listing || errcount)
 	oprint (-1, fmt ("####################### %5 passes. global/local labels (MAX %5): %5 / %5\n",
-	    pass, MAX_LABELS, nlabel, MAX_LABELS - lstack
+	    pass, MAX_LABELS, nlabel, nlocal
 	    ));
+    if (listing && nsect > 1)
+	for (unsigned i = 0; i < nsect; i++) {
+	    unsigned at = vsect[i].hi > vsect[i].lo ? vsect[i].lo : vsect[i].origin;
+	    oprint (-1, fmt ("####################### section %s at %w.%w, %5 bytes\n", vsect[i].name,
+		at >> 16, at, vsect[i].hi > vsect[i].lo ? vsect[i].hi - vsect[i].lo : 0));
+	}
+    if (show_stats)
+	stats_report (clock_ns (CLOCK_MONOTONIC) - wall0, clock_ns (CLOCK_PROCESS_CPUTIME_ID) - cpu0);
 
     // error summary
     if (errcount) {
@@ -1245,13 +3736,47 @@ int main (int argc, char **argv) {
 	return 1;
     }
 
+    // optimizer summary
+    if (peep.on)
+	eprint (-1, fmt ("eonasm: peephole saved %U bytes in %U instructions\n",
+	    (unsigned long long) peep.bytes, (unsigned long long) peep.rewrites));
+    if (tail.on)
+	eprint (-1, fmt ("eonasm: fused %U tail calls, threaded %U branches, saved %U bytes and ~%U cycles\n",
+	    (unsigned long long) tail.fused, (unsigned long long) tail.threaded, (unsigned long long) tail.bytes,
+	    (unsigned long long) (tail.fused + tail.hops) * TRANSFER_CYCLES));
+    if (unreach.report && unreach.runs)
+	eprint (-1, fmt ("eonasm: %U unreachable instructions in %U runs, %U bytes%s\n",
+	    (unsigned long long) unreach.insns, (unsigned long long) unreach.runs, (unsigned long long) unreach.bytes,
+	    unreach.strip ? " stripped" : ""));
+    if (branches.on)
+	branch_report ();
+    else if (relaxed)
+	eprint (-1, fmt ("eonasm: %U branches relaxed to the long form\n", (unsigned long long) relaxed));
+    if (loops.size)
+	eprint (-1, fmt ("eonasm: aligned %U loop heads to %5 bytes with %U bytes of nop\n",
+	    (unsigned long long) loops.heads, loops.size, (unsigned long long) loops.bytes));
+    if (pool.base >= 0 && !pool.placed)
+	eprint (-1, "eonasm: -P without .POOL, no literals pooled\n");
+    else if (pool.base >= 0)
+	eprint (-1, fmt ("eonasm: literal pool %U entries for %U loads, %U bytes\n",
+	    (unsigned long long) pool.nslot, (unsigned long long) pool.loads,
+	    (unsigned long long) (pool.nslot ? pool.pad + 4 * pool.nslot : 0)));
+
+    // symbol snapshot
+    if (syms.export) {
+	sym_export (syms.export);
+	eprint (-1, fmt ("eonasm: exported %U symbols to [%s]\n", (unsigned long long) syms.exported, syms.export));
+    }
+
     // dump unused labels
-    if (unused)
-	for (unsigned i = 0; i < nlabel; ++i) {
-	    label_t l = &tlabel[i];
-	    if (!(l->flags & LABEL_USED))
+    for (unsigned i = 0; i < nlabel; ++i) {
+	label_t l = &tlabel[i];
+	if (!(l->flags & LABEL_USED)) {
+	    warning (srcs.v[l->file].name, l->lineno, "unused label", l->name, l->len);
+	    if (unused)
 		eprint (-1, fmt ("eonasm: unused label [%s]\n", l->name));
 	}
+    }
 
     // done
     return 0;